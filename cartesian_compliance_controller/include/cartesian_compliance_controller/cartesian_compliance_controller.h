@@ -40,8 +40,10 @@
 #ifndef CARTESIAN_COMPLIANCE_CONTROLLER_H_INCLUDED
 #define CARTESIAN_COMPLIANCE_CONTROLLER_H_INCLUDED
 
+#include <cartesian_controller_base/ParameterSnapshot.h>
 #include <cartesian_controller_base/ROS2VersionConfig.h>
 #include <cartesian_controller_base/cartesian_controller_base.h>
+#include <cartesian_controller_base/core/CartesianMath.h>
 #include <cartesian_force_controller/cartesian_force_controller.h>
 #include <cartesian_motion_controller/cartesian_motion_controller.h>
 #include <controller_interface/controller_interface.hpp>
@@ -109,8 +111,12 @@ class CartesianComplianceController
      */
     ctrl::Vector6D        computeComplianceError();
 
-    ctrl::Matrix6D        m_stiffness;
     std::string           m_compliance_ref_link;
+    int                   m_compliance_ref_index = {-1};
+
+    // Dynamic parameters
+    using ComplianceParameters = cartesian_controller_base::core::ComplianceErrorParameters;
+    cartesian_controller_base::ParameterSnapshot<ComplianceParameters> m_compliance_parameters;
 
 };
 
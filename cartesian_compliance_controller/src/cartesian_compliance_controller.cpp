@@ -86,6 +86,15 @@ controller_interface::return_type CartesianComplianceController::init(const std:
 
   auto_declare<std::string>("compliance_ref_link", "");
 
+  constexpr double default_lin_stiff = 500.0;
+  constexpr double default_rot_stiff = 50.0;
+  auto_declare<double>("stiffness.trans_x", default_lin_stiff);
+  auto_declare<double>("stiffness.trans_y", default_lin_stiff);
+  auto_declare<double>("stiffness.trans_z", default_lin_stiff);
+  auto_declare<double>("stiffness.rot_x", default_rot_stiff);
+  auto_declare<double>("stiffness.rot_y", default_rot_stiff);
+  auto_declare<double>("stiffness.rot_z", default_rot_stiff);
+
   return TYPE::OK;
 }
 #endif
@@ -109,10 +118,33 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn Cartes
                                               << Base::m_end_effector_link);
     return TYPE::ERROR;
   }
+  m_compliance_ref_index = Base::linkIndex(m_compliance_ref_link);
 
   // Make sure sensor wrenches are interpreted correctly
   ForceBase::setFtSensorReferenceFrame(m_compliance_ref_link);
 
+  // Realtime-safe access to the stiffness parameters
+  const std::vector<std::string> stiffness = {
+    "stiffness.trans_x", "stiffness.trans_y", "stiffness.trans_z",
+    "stiffness.rot_x",   "stiffness.rot_y",   "stiffness.rot_z"};
+  if (!m_compliance_parameters.init(
+        get_node(),
+        stiffness,
+        [stiffness](const rclcpp::Parameter& parameter, ComplianceParameters& params, std::string& reason) {
+          for (size_t i = 0; i < stiffness.size(); ++i)
+          {
+            if (parameter.get_name() == stiffness[i])
+            {
+              return cartesian_controller_base::parameters::assign(
+                parameter, params.stiffness[i], reason, 0.0);
+            }
+          }
+          return true;
+        }))
+  {
+    return TYPE::ERROR;
+  }
+
   return TYPE::SUCCESS;
 }
 
@@ -147,22 +179,32 @@ controller_interface::return_type CartesianComplianceController::update(const rc
 controller_interface::return_type CartesianComplianceController::update()
 #endif
 {
+#if defined CARTESIAN_CONTROLLERS_FOXY
+  // Unknown control period.  This disables time budgets.
+  const auto period = rclcpp::Duration::from_seconds(0.0);
+  const auto time = get_node()->now();
+#endif
+
   // Synchronize the internal model and the real robot
-  Base::m_ik_solver->synchronizeJointPositions(Base::m_joint_state_pos_handles);
+  {
+    CARTESIAN_CONTROLLERS_MEASURE_LATENCY(Base::m_latencies[Base::JOINT_STATE_SYNC]);
+    Base::m_ik_solver->synchronizeJointPositions(Base::m_joint_state_pos_handles);
+  }
+  MotionBase::fetchTargetFrame(time);
+  ForceBase::fetchWrenches();
 
   // Control the robot motion in such a way that the resulting net force
-  // vanishes. This internal control needs some simulation time steps.
-  for (int i = 0; i < Base::m_iterations; ++i)
+  // vanishes. This internal control needs some simulation time steps.  The
+  // internal 'simulation time' is deliberately independent of the outer
+  // control cycle.
+  auto internal_period = rclcpp::Duration::from_seconds(0.02);
+
+  // Run the solver only every solver.decimation cycles and extrapolate the
+  // joint commands in between
+  if (!Base::extrapolateJointControlCmds())
   {
-    // The internal 'simulation time' is deliberately independent of the outer
-    // control cycle.
-    auto internal_period = rclcpp::Duration::from_seconds(0.02);
-
-    // Compute the net force
-    ctrl::Vector6D error = computeComplianceError();
-
-    // Turn Cartesian error into joint motion
-    Base::computeJointControlCmds(error,internal_period);
+    // Turn the net force into joint motion
+    Base::iterateJointControlCmds([this]() { return computeComplianceError(); }, internal_period, period);
   }
 
   // Write final commands to the hardware interface
@@ -173,25 +215,11 @@ controller_interface::return_type CartesianComplianceController::update()
 
 ctrl::Vector6D CartesianComplianceController::computeComplianceError()
 {
-  ctrl::Vector6D tmp;
-  tmp[0] = get_node()->get_parameter("stiffness.trans_x").as_double();
-  tmp[1] = get_node()->get_parameter("stiffness.trans_y").as_double();
-  tmp[2] = get_node()->get_parameter("stiffness.trans_z").as_double();
-  tmp[3] = get_node()->get_parameter("stiffness.rot_x").as_double();
-  tmp[4] = get_node()->get_parameter("stiffness.rot_y").as_double();
-  tmp[5] = get_node()->get_parameter("stiffness.rot_z").as_double();
-
-  m_stiffness = tmp.asDiagonal();
-
-  ctrl::Vector6D net_force =
-
-    // Spring force in base orientation
-    Base::displayInBaseLink(m_stiffness,m_compliance_ref_link) * MotionBase::computeMotionError()
-
-    // Sensor and target force in base orientation
-    + ForceBase::computeForceError();
-
-  return net_force;
+  return cartesian_controller_base::core::computeComplianceError(
+    m_compliance_parameters.get(),
+    MotionBase::computeMotionError(),
+    ForceBase::computeForceError(),
+    Base::m_ik_solver->getKinematics().getFrame(m_compliance_ref_index).M);
 }
 
 } // namespace
@@ -0,0 +1,401 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    ik_solver_benchmark.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+/**
+ * Benchmark all registered IK solver plugins on synthetic serial chains.
+ *
+ * Each benchmark times one control step, i.e. `getJointControlCmds()`
+ * followed by `updateKinematics()`, as the controllers call them in
+ * `computeJointControlCmds()`.  Besides the mean time per step, we report
+ *
+ * - `p50_us`, `p99_us`, `max_us`: latency percentiles of the individual steps
+ * - `allocs_per_call`: heap allocations per step, which should be zero.
+ *   These include operator new and, with glibc only, malloc, calloc and
+ *   realloc, but no other C allocation functions.
+ * - the scaling against the number of joints (BigO, RMS)
+ *
+ * Run with
+ * \code{.sh}
+ * colcon build --packages-select cartesian_controller_base --cmake-args -DBUILD_BENCHMARKS=ON
+ * ros2 run cartesian_controller_base ik_solver_benchmark
+ * \endcode
+ *
+ * Google benchmark's command line options apply, e.g.
+ * `--benchmark_filter=damped_least_squares` or `--benchmark_format=json`.
+ */
+
+#include "ROS2VersionConfig.h"
+#include <algorithm>
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cartesian_controller_base/IKSolver.h>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <kdl/chain.hpp>
+#include <kdl/jntarray.hpp>
+#include <memory>
+#include <new>
+#include <pluginlib/class_loader.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <trajectory_msgs/msg/joint_trajectory_point.hpp>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// Allocation counting
+//-----------------------------------------------------------------------------
+
+// We count allocations through the replaced global operator new and delete,
+// including their aligned and nothrow overloads.  Eigen allocates
+// dynamic-size matrices with std::malloc, though.  With glibc, we therefore
+// also interpose malloc, calloc and realloc.  Other C allocation functions,
+// such as aligned_alloc and posix_memalign, are not counted.  On other C
+// libraries, only operator new is counted.
+namespace
+{
+std::atomic<std::size_t> g_allocations{0};
+}
+
+#ifdef __GLIBC__
+extern "C"
+{
+void* __libc_malloc(std::size_t size);
+void* __libc_calloc(std::size_t n, std::size_t size);
+void* __libc_realloc(void* ptr, std::size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(std::size_t size) noexcept
+{
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+
+void* calloc(std::size_t n, std::size_t size) noexcept
+{
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_calloc(n, size);
+}
+
+void* realloc(void* ptr, std::size_t size) noexcept
+{
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_realloc(ptr, size);
+}
+}
+#endif
+
+namespace
+{
+
+// Count once per allocation, also if malloc is interposed above
+void* countedAlloc(std::size_t size) noexcept
+{
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+#ifdef __GLIBC__
+  return __libc_malloc(size > 0 ? size : 1);
+#else
+  return std::malloc(size > 0 ? size : 1);
+#endif
+}
+
+void* countedAlignedAlloc(std::size_t size, std::align_val_t alignment) noexcept
+{
+  g_allocations.fetch_add(1, std::memory_order_relaxed);
+  const std::size_t align = static_cast<std::size_t>(alignment);
+  return std::aligned_alloc(align, (std::max<std::size_t>(size, 1) + align - 1) / align * align);
+}
+
+void release(void* ptr) noexcept
+{
+#ifdef __GLIBC__
+  __libc_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+  if (void* ptr = countedAlloc(size))
+  {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return countedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return countedAlloc(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+  if (void* ptr = countedAlignedAlloc(size, alignment))
+  {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+  return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+  return countedAlignedAlloc(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+  return countedAlignedAlloc(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept { release(ptr); }
+void operator delete[](void* ptr) noexcept { release(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { release(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { release(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { release(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { release(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { release(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { release(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { release(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { release(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { release(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { release(ptr); }
+
+namespace
+{
+
+using cartesian_controller_base::IKSolver;
+
+#if defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
+using NodeType = rclcpp_lifecycle::LifecycleNode;
+#else
+using NodeType = rclcpp::Node;
+#endif
+
+std::shared_ptr<pluginlib::ClassLoader<IKSolver> > g_solver_loader;
+
+//-----------------------------------------------------------------------------
+// Synthetic robots
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief Build a serial chain with the given number of revolute joints
+ *
+ * Joint axes cycle through z, y, y, z, y, x, similar to common industrial
+ * arms, so that the chain is not singular in its zero configuration.
+ *
+ * @param dof The number of revolute joints
+ * @param fixed_per_joint Number of fixed segments after each revolute one,
+ * e.g. to mimic flanges, sensors and tool frames in URDF descriptions
+ *
+ * @return The chain
+ */
+KDL::Chain buildChain(int dof, int fixed_per_joint)
+{
+  const KDL::Joint::JointType axes[] = {
+    KDL::Joint::RotZ, KDL::Joint::RotY, KDL::Joint::RotY,
+    KDL::Joint::RotZ, KDL::Joint::RotY, KDL::Joint::RotX};
+
+  KDL::Chain chain;
+  for (int i = 0; i < dof; ++i)
+  {
+    const std::string name = "link_" + std::to_string(i);
+    chain.addSegment(KDL::Segment(
+        name,
+        KDL::Joint("joint_" + std::to_string(i), axes[i % 6]),
+        KDL::Frame(KDL::Rotation::RPY(0.0, 0.1, 0.0), KDL::Vector(0.02, 0.0, 0.8 / dof + 0.05))));
+
+    for (int j = 0; j < fixed_per_joint; ++j)
+    {
+      chain.addSegment(KDL::Segment(
+          name + "_fixed_" + std::to_string(j),
+          KDL::Joint(KDL::Joint::None),
+          KDL::Frame(KDL::Vector(0.0, 0.0, 0.01))));
+    }
+  }
+  return chain;
+}
+
+//-----------------------------------------------------------------------------
+// Benchmark
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief Time one control step of the given solver plugin
+ *
+ * The number of joints is taken from the benchmark's range(0).
+ *
+ * @param state The benchmark's state
+ * @param solver_name The plugin to benchmark
+ * @param fixed_per_joint Number of fixed segments after each joint
+ */
+void controlStep(benchmark::State& state, const std::string& solver_name, int fixed_per_joint)
+{
+  const int dof = static_cast<int>(state.range(0));
+
+  // Each solver declares its parameters on initialization.
+  // Give each instance a fresh node to avoid name clashes.
+  static int instance = 0;
+  auto node = std::make_shared<NodeType>(
+      "ik_solver_benchmark_" + std::to_string(instance++));
+
+  std::shared_ptr<IKSolver> solver = g_solver_loader->createSharedInstance(solver_name);
+
+  KDL::Chain chain = buildChain(dof, fixed_per_joint);
+  KDL::JntArray upper_pos_limits(dof);
+  KDL::JntArray lower_pos_limits(dof);
+  upper_pos_limits.data.setConstant(M_PI);
+  lower_pos_limits.data.setConstant(-M_PI);
+
+  if (!solver->init(node, chain, upper_pos_limits, lower_pos_limits))
+  {
+    state.SkipWithError("Failed to initialize the solver");
+    return;
+  }
+
+  // Preallocated output buffer, as in the controllers
+  trajectory_msgs::msg::JointTrajectoryPoint control_cmd;
+  control_cmd.positions.resize(dof);
+  control_cmd.velocities.resize(dof);
+
+  // A constant wrench that keeps the simulated robot moving
+  ctrl::Vector6D net_force;
+  net_force << 5.0, -3.0, 2.0, 0.5, -0.2, 0.3;
+  const rclcpp::Duration period = rclcpp::Duration::from_seconds(0.002);
+
+  // Warm up caches and lazily sized buffers
+  for (int i = 0; i < 100; ++i)
+  {
+    solver->getJointControlCmds(period, net_force, control_cmd);
+    solver->updateKinematics();
+  }
+
+  // Latencies of the most recent steps for percentile estimation
+  std::vector<double> latencies(1 << 16);
+  std::size_t samples = 0;
+
+  const std::size_t allocations_before = g_allocations.load();
+  for (auto _ : state)
+  {
+    const auto start = std::chrono::steady_clock::now();
+
+    solver->getJointControlCmds(period, net_force, control_cmd);
+    solver->updateKinematics();
+
+    const auto stop = std::chrono::steady_clock::now();
+    latencies[samples++ % latencies.size()] =
+      std::chrono::duration<double, std::micro>(stop - start).count();
+
+    benchmark::DoNotOptimize(control_cmd.positions.data());
+    benchmark::ClobberMemory();
+  }
+  const std::size_t allocations = g_allocations.load() - allocations_before;
+
+  latencies.resize(std::min(samples, latencies.size()));
+  if (latencies.empty())
+  {
+    return;
+  }
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](double p) {
+    return latencies[static_cast<std::size_t>(p * (latencies.size() - 1))];
+  };
+
+  state.counters["p50_us"] = percentile(0.5);
+  state.counters["p99_us"] = percentile(0.99);
+  state.counters["max_us"] = latencies.back();
+  state.counters["allocs_per_call"] =
+    benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+  state.counters["segments"] = chain.getNrOfSegments();
+  state.SetComplexityN(dof);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  rclcpp::init(argc, argv);
+  benchmark::Initialize(&argc, argv);
+
+  g_solver_loader = std::make_shared<pluginlib::ClassLoader<IKSolver> >(
+    "cartesian_controller_base", "cartesian_controller_base::IKSolver");
+
+  // One family per solver and chain type, so that each gets its own scaling curve.
+  for (const auto& solver_name : g_solver_loader->getDeclaredClasses())
+  {
+    for (int fixed_per_joint : {0, 3})
+    {
+      const std::string name =
+        solver_name + (fixed_per_joint > 0 ? "/with_fixed_segments" : "/revolute_only");
+
+      benchmark::RegisterBenchmark(name.c_str(), controlStep, solver_name, fixed_per_joint)
+        ->ArgName("dof")
+        ->Arg(6)
+        ->Arg(7)
+        ->Arg(12)
+        ->Arg(30)
+        ->Unit(benchmark::kMicrosecond)
+        ->Complexity();
+    }
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  g_solver_loader.reset();
+  rclcpp::shutdown();
+  return 0;
+}
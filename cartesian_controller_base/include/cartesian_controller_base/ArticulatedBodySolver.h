@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    ArticulatedBodySolver.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef ARTICULATED_BODY_SOLVER_H_INCLUDED
+#define ARTICULATED_BODY_SOLVER_H_INCLUDED
+
+#include <cartesian_controller_base/IKSolver.h>
+#include <cartesian_controller_base/ParameterSnapshot.h>
+#include <cartesian_controller_base/core/ArticulatedBodySolver.h>
+#include <memory>
+#include <string>
+
+namespace cartesian_controller_base{
+
+/*! \brief Forward dynamics IK solver with linear complexity
+ *
+ *  Plugin adapter for \ref core::ArticulatedBodySolver.  See there for the
+ *  algorithm.  The virtual link mass is a dynamic parameter of the node.
+ */
+class ArticulatedBodySolver : public IKSolver
+{
+  public:
+    ArticulatedBodySolver();
+    ~ArticulatedBodySolver();
+
+    /**
+     * @brief Compute joint target commands with approximate forward dynamics
+     *
+     * @param period The duration in sec for this simulation step
+     * @param net_force The applied net force, expressed in the root frame
+     * @param control_cmd Holds positions and velocities of each joint on return
+     */
+    void getJointControlCmds(
+        rclcpp::Duration period,
+        const ctrl::Vector6D& net_force,
+        trajectory_msgs::msg::JointTrajectoryPoint& control_cmd) override;
+
+    using IKSolver::getJointControlCmds;
+
+    /**
+     * @brief Initialize the solver
+     *
+     * @param nh A node handle for namespace-local parameter management
+     * @param chain The kinematic chain of the robot
+     * @param upper_pos_limits Tuple with max positive joint angles
+     * @param lower_pos_limits Tuple with max negative joint angles
+     *
+     * @return True, if everything went well
+     */
+#if defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
+    bool init(std::shared_ptr<rclcpp_lifecycle::LifecycleNode> nh,
+#else
+    bool init(std::shared_ptr<rclcpp::Node> nh,
+#endif
+              const KDL::Chain& chain,
+              const KDL::JntArray& upper_pos_limits,
+              const KDL::JntArray& lower_pos_limits) override;
+
+  private:
+    core::ArticulatedBodySolver m_solver;
+
+    // Dynamic parameters
+    const std::string m_params = "solver/articulated_body"; ///< namespace for parameter access
+    ParameterSnapshot<core::ArticulatedBodySolver::Parameters> m_parameters; ///< realtime-safe copy of the dynamic parameters
+};
+
+
+} // namespace
+
+#endif
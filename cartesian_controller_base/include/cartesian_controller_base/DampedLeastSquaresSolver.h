@@ -42,27 +42,18 @@
 
 #include "rclcpp/node.hpp"
 #include <cartesian_controller_base/IKSolver.h>
-#include <kdl/jacobian.hpp>
+#include <cartesian_controller_base/ParameterSnapshot.h>
+#include <cartesian_controller_base/core/DampedLeastSquaresSolver.h>
 #include <memory>
+#include <string>
 
 namespace cartesian_controller_base{
 
   /**
    * \brief A damped least squares IK solver for Cartesian controllers
    *
-   *
-   *  The resulting joint velocities are computed according to
-   *  \f$ \dot{q} = ( J^T J + \alpha^2 I )^{-1} J^T f \f$
-   *  Where \f$ J \f$ denotes the manipulator's joint Jacobian and \f$ f \f$ is
-   *  the applied force to the end effector.
-   *  \f$ \alpha \f$ is a damping term.
-   *  For controlling end effector motion, e.g. in the
-   *  \ref cartesian_motion_controller::CartesianMotionController \f$ f \f$ should be
-   *  thought of as an error direction vector that is mapped to wrench space
-   *  with a unit stiffness.
-   *
-   *  The damped least squares formulation is according to Wampler
-   *  https://ieeexplore.ieee.org/abstract/document/4075580  
+   * Plugin adapter for \ref core::DampedLeastSquaresSolver.  See there for
+   * the algorithm.  The damping is a dynamic parameter of the node.
    */
 class DampedLeastSquaresSolver : public IKSolver
 {
@@ -75,12 +66,14 @@ class DampedLeastSquaresSolver : public IKSolver
      *
      * \param period The duration in sec for this simulation step
      * \param net_force The applied net force, expressed in the root frame
-     *
-     * \return A point holding positions, velocities and accelerations of each joint
+     * \param control_cmd Holds positions and velocities of each joint on return
      */
-    trajectory_msgs::msg::JointTrajectoryPoint getJointControlCmds(
+    void getJointControlCmds(
         rclcpp::Duration period,
-        const ctrl::Vector6D& net_force) override;
+        const ctrl::Vector6D& net_force,
+        trajectory_msgs::msg::JointTrajectoryPoint& control_cmd) override;
+
+    using IKSolver::getJointControlCmds;
 
     /**
      * \brief Initialize the solver
@@ -102,13 +95,11 @@ class DampedLeastSquaresSolver : public IKSolver
               const KDL::JntArray& lower_pos_limits) override;
 
   private:
-    std::shared_ptr<KDL::ChainJntToJacSolver> m_jnt_jacobian_solver;
-    KDL::Jacobian m_jnt_jacobian;
+    core::DampedLeastSquaresSolver m_solver;
 
     // Dynamic parameters
-    std::shared_ptr<rclcpp::Node> m_handle; ///< handle for dynamic parameter interaction
     const std::string m_params = "solver/damped_least_squares"; ///< namespace for parameter access
-    double m_alpha; ///< damping coefficient
+    ParameterSnapshot<core::DampedLeastSquaresSolver::Parameters> m_parameters; ///< realtime-safe copy of the dynamic parameters
 
 };
 
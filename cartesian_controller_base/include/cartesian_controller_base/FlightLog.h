@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    FlightLog.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef FLIGHT_LOG_H_INCLUDED
+#define FLIGHT_LOG_H_INCLUDED
+
+#include <array>
+#include <cartesian_controller_base/FlightRecorder.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cartesian_controller_base
+{
+
+/**
+ * @brief Read access to the files of the \ref FlightRecorder
+ *
+ * Loads the whole file and presents the valid records in chronological
+ * order, i.e. record 0 is the oldest one that is still in the file.
+ *
+ * Not realtime-safe.
+ */
+class FlightLog
+{
+  public:
+    FlightLog();
+
+    /**
+     * @brief Load a recording
+     *
+     * @param file Path of the binary file
+     * @param error Description of what went wrong
+     *
+     * @return True on success
+     */
+    bool open(const std::string& file, std::string& error);
+
+    //! The number of valid records
+    size_t size() const { return m_size; }
+
+    const FlightRecorder::FileHeader& header() const { return m_header; }
+
+    //! The number of doubles of the given field
+    size_t fieldSize(FlightRecorder::Field field) const { return m_field_sizes[field]; }
+
+    //! The sample's sequence number.  Gaps mean dropped samples.
+    uint64_t sequence(size_t record) const;
+
+    //! The sample's system time stamp in nanoseconds
+    int64_t stamp(size_t record) const;
+
+    //! Whether the given \ref FlightRecorder::Event happened in the record's cycle
+    bool event(size_t record, FlightRecorder::Event event) const
+    {
+      return static_cast<uint32_t>(*field(record, FlightRecorder::EVENTS)) & event;
+    }
+
+    /**
+     * @brief Access a field of the given record
+     *
+     * @param record The index in chronological order
+     * @param field The quantity to read
+     *
+     * @return The field's first value
+     */
+    const double* field(size_t record, FlightRecorder::Field field) const
+    {
+      return data(record) + m_field_offsets[field];
+    }
+
+  private:
+    const double* data(size_t record) const;
+
+    FlightRecorder::FileHeader m_header;
+    std::array<size_t, FlightRecorder::NUM_FIELDS> m_field_offsets;  ///< in doubles
+    std::array<size_t, FlightRecorder::NUM_FIELDS> m_field_sizes;    ///< in doubles
+    size_t m_record_words = {0};
+    size_t m_first = {0};  ///< file index of the oldest record
+    size_t m_size = {0};
+    std::vector<double> m_records;
+};
+
+}
+
+#endif
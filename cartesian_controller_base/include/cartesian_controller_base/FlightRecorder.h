@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    FlightRecorder.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef FLIGHT_RECORDER_H_INCLUDED
+#define FLIGHT_RECORDER_H_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <kdl/frames.hpp>
+#include <mutex>
+#include <rclcpp/logger.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cartesian_controller_base
+{
+
+/**
+ * @brief Record the controller's internals of each cycle to a binary file
+ *
+ * The control loop fills the fields of the current sample and commits it
+ * once per cycle into a preallocated, lock-free ring buffer.  This is a
+ * bounded copy without system calls.  Samples are dropped and counted if the
+ * ring is full.  A background thread drains the ring into a memory-mapped
+ * file that itself is a ring of the most recent samples.  The kernel writes
+ * mapped pages back even if the process dies, and \ref flush() makes sure
+ * that nothing is lost on a controlled shutdown.
+ *
+ * File layout, all in host byte order:
+ * - \ref FileHeader
+ * - \a capacity records of \a record_size bytes.  Each record starts with
+ *   the sample's sequence number (uint64) and its system time stamp in
+ *   nanoseconds (int64), followed by the fields in the order of \ref Field
+ *   as doubles.  Records are placed in the order they are drained, i.e.
+ *   the n-th record written is at index \a n % \a capacity with \a n counting
+ *   up to \a records_written.  Dropped samples leave no record, so gaps in
+ *   the sequence numbers of consecutive records mark drops.
+ */
+class FlightRecorder
+{
+  public:
+    //! The recorded quantities of each sample
+    enum Field
+    {
+      JOINT_POSITIONS,       ///< measured, number_joints
+      TARGET_FRAME,          ///< x, y, z, qx, qy, qz, qw in the robot base link
+      TARGET_WRENCH,         ///< 6
+      SENSOR_WRENCH,         ///< 6, as measured
+      CARTESIAN_INPUT,       ///< 6, the solver's net force
+      SIMULATED_POSITIONS,   ///< number_joints
+      SIMULATED_VELOCITIES,  ///< number_joints
+      STAGE_LATENCIES,       ///< number_stages, last sample of each stage in seconds
+      ITERATIONS,            ///< 1, internal solver iterations
+      EVENTS,                ///< 1, bitwise or of the \ref Event "Events" before or in this cycle
+      START_VELOCITIES,      ///< number_joints, internal joint velocities on the last activation
+      TOOL_LINK,             ///< 1, the tool center point's parent link, see CartesianControllerBase::linkIndex()
+      TOOL_FRAME,            ///< x, y, z, qx, qy, qz, qw of the tool center point in its parent link
+      NUM_FIELDS
+    };
+
+    //! What changed the controller's state besides the recorded inputs
+    enum Event
+    {
+      ACTIVATION  = 1 << 0,  ///< Started from the measured joint positions and \ref START_VELOCITIES
+      HOT_STANDBY = 1 << 1,  ///< Start velocities came from the hot standby
+      MODEL_SWAP  = 1 << 2,  ///< A reloaded robot model was swapped in after the previous cycle
+      TOOL_SWITCH = 1 << 3   ///< Switched to \ref TOOL_LINK and \ref TOOL_FRAME in this cycle
+    };
+
+    //! Start of the binary file
+    struct FileHeader
+    {
+      char     magic[8];          ///< "CCFLIGHT"
+      uint32_t version;
+      uint32_t number_joints;
+      uint32_t number_stages;
+      uint32_t record_size;       ///< bytes per record
+      uint64_t capacity;          ///< number of records in the file
+      uint64_t records_written;   ///< total, the valid ones are the last min(records_written, capacity)
+      uint64_t samples_dropped;   ///< samples lost because the ring buffer was full
+    };
+
+    static constexpr uint32_t VERSION = 4;
+
+    FlightRecorder();
+    ~FlightRecorder();
+
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    /**
+     * @brief Allocate all buffers, map the file and start draining
+     *
+     * Not realtime-safe.
+     *
+     * @param file Path of the binary file.  Existing files are overwritten
+     * @param number_joints The number of joints
+     * @param number_stages The number of latency stages
+     * @param capacity The number of records in the file
+     * @param logger For reporting errors
+     *
+     * @return True if recording is active
+     */
+    bool init(const std::string& file,
+              int number_joints,
+              int number_stages,
+              size_t capacity,
+              const rclcpp::Logger& logger);
+
+    /**
+     * @brief Compute the record layout for the given dimensions
+     *
+     * @param number_joints The number of joints
+     * @param number_stages The number of latency stages
+     * @param offsets The offset of each field in doubles, including the record's header
+     * @param sizes The number of doubles of each field
+     *
+     * @return The record size in doubles
+     */
+    static size_t layout(int number_joints,
+                         int number_stages,
+                         std::array<size_t, NUM_FIELDS>& offsets,
+                         std::array<size_t, NUM_FIELDS>& sizes);
+
+    //! Whether recording is active
+    bool enabled() const { return m_enabled; }
+
+    /**
+     * @brief Access a field of the current sample
+     *
+     * Realtime-safe.  Only call this if \ref enabled().
+     *
+     * @param field The quantity to write
+     *
+     * @return The field's first value
+     */
+    double* field(Field field) { return m_sample.data() + m_field_offsets[field]; }
+
+    //! Write a Cartesian quantity to the current sample.  No-op if disabled.
+    template <class Vector>
+    void set(Field field, const Vector& values)
+    {
+      if (m_enabled)
+      {
+        double* data = this->field(field);
+        for (int i = 0; i < static_cast<int>(m_field_sizes[field]); ++i)
+        {
+          data[i] = values[i];
+        }
+      }
+    }
+
+    //! Write a pose to the current sample.  No-op if disabled.
+    void set(Field field, const KDL::Frame& frame);
+
+    //! Mark an event in the current sample.  No-op if disabled.
+    void event(Event event);
+
+    /**
+     * @brief Commit the current sample to the ring buffer
+     *
+     * Realtime-safe and wait-free.  The fields keep their values for the
+     * next sample, except for the \ref EVENTS.
+     *
+     * @param stamp_ns The sample's time stamp in nanoseconds
+     */
+    void commit(int64_t stamp_ns);
+
+    /**
+     * @brief Write all committed samples to the file and sync it to disk
+     *
+     * Blocks until done.  Intended for the shutdown path.
+     */
+    void flush();
+
+  private:
+    //! Move all committed samples from the ring buffer into the file
+    void drain();
+
+    //! Background thread that calls drain() periodically
+    void run();
+
+    void stop();
+
+    bool m_enabled = {false};
+    std::array<size_t, NUM_FIELDS> m_field_offsets;  ///< in doubles
+    std::array<size_t, NUM_FIELDS> m_field_sizes;    ///< in doubles
+    size_t m_record_words = {0};                     ///< record size in doubles
+    std::vector<double> m_sample;
+    uint64_t m_sequence = {0};                       ///< number of the current sample
+
+    // Single-producer, single-consumer ring buffer
+    std::vector<double> m_ring;
+    size_t m_slots = {0};
+    std::atomic<uint64_t> m_head = {0};  ///< next sample to commit
+    std::atomic<uint64_t> m_tail = {0};  ///< next sample to drain
+    std::atomic<uint64_t> m_dropped = {0};
+
+    // Memory-mapped file
+    int m_fd = {-1};
+    void* m_map = {nullptr};
+    size_t m_map_size = {0};
+    FileHeader* m_header = {nullptr};
+    char* m_records = {nullptr};
+
+    std::mutex m_drain_mutex;  ///< Serializes draining, never taken by the producer
+    std::mutex m_thread_mutex;
+    std::condition_variable m_wakeup;
+    bool m_stop = {false};
+    std::thread m_thread;
+};
+
+}
+
+#endif
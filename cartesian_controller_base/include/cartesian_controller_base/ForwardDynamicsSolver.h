@@ -43,34 +43,19 @@
 
 #include "rclcpp/node.hpp"
 #include <cartesian_controller_base/IKSolver.h>
+#include <cartesian_controller_base/ParameterSnapshot.h>
 #include <cartesian_controller_base/Utility.h>
+#include <cartesian_controller_base/core/ForwardDynamicsSolver.h>
 #include <kdl/chain.hpp>
-#include <kdl/chaindynparam.hpp>
-#include <kdl/chainfksolverpos_recursive.hpp>
-#include <kdl/chainfksolvervel_recursive.hpp>
-#include <kdl/chainjnttojacsolver.hpp>
-#include <kdl/frames.hpp>
-#include <kdl/jacobian.hpp>
 #include <memory>
-#include <vector>
+#include <string>
 
 namespace cartesian_controller_base{
 
 /*! \brief The default IK solver for Cartesian controllers
  *
- *  This class computes manipulator joint motion from Cartesian force inputs.
- *  As inputs, both forces and torques are applied to the mechanical system,
- *  representing the manipulator. The system is modeled as a chain of rigid
- *  bodies. All bodies except for the last one are massless. This is to
- *  achieve a nearly linear behavior in all joint configurations.
- *  The resulting joint accelerations are computed according to
- *  \f$ \ddot{q} = H^{-1} ( J^T f) \f$
- *  Where \f$ H \f$ denotes the joint space inertia matrix of the virtually
- *  conditioned system, \f$ J \f$ denotes the joint Jacobian and \f$ f \f$ is
- *  the applied force to the end effector.  The joint accelerations are
- *  integrated twice to obtain joint velocities and joint positions
- *  respectively.
- *  Check more details behind the solver here: https://arxiv.org/pdf/1908.06252.pdf
+ *  Plugin adapter for \ref core::ForwardDynamicsSolver.  See there for the
+ *  algorithm.  The virtual link mass is a dynamic parameter of the node.
  */
 class ForwardDynamicsSolver : public IKSolver
 {
@@ -86,12 +71,14 @@ class ForwardDynamicsSolver : public IKSolver
      *
      * @param period The duration in sec for this simulation step
      * @param net_force The applied net force, expressed in the root frame
-     *
-     * @return A point holding positions, velocities and accelerations of each joint
+     * @param control_cmd Holds positions and velocities of each joint on return
      */
-    trajectory_msgs::msg::JointTrajectoryPoint getJointControlCmds(
+    void getJointControlCmds(
         rclcpp::Duration period,
-        const ctrl::Vector6D& net_force) override;
+        const ctrl::Vector6D& net_force,
+        trajectory_msgs::msg::JointTrajectoryPoint& control_cmd) override;
+
+    using IKSolver::getJointControlCmds;
 
     /**
      * @brief Initialize the solver
@@ -112,28 +99,20 @@ class ForwardDynamicsSolver : public IKSolver
               const KDL::JntArray& upper_pos_limits,
               const KDL::JntArray& lower_pos_limits) override;
 
-  private:
-
-    //! Build a generic robot model for control
-    bool buildGenericModel();
+    /**
+     * @brief Number of times the generic model has been built
+     *
+     * This includes the initial build in init().  Each change of the \a
+     * link_mass parameter triggers a rebuild in the next control cycle.
+     */
+    unsigned int getModelBuildCount() const { return m_solver.getModelBuildCount(); }
 
-    // Forward dynamics
-    std::shared_ptr<KDL::ChainJntToJacSolver> m_jnt_jacobian_solver;
-    std::shared_ptr<KDL::ChainDynParam>       m_jnt_space_inertia_solver;
-    KDL::Jacobian                               m_jnt_jacobian;
-    KDL::JntSpaceInertiaMatrix                  m_jnt_space_inertia;
+  private:
+    core::ForwardDynamicsSolver m_solver;
 
     // Dynamic parameters
-    std::shared_ptr<rclcpp::Node> m_handle; ///< handle for dynamic parameter interaction
     const std::string m_params = "solver/forward_dynamics"; ///< namespace for parameter access
-
-    /**
-     * Virtual link mass
-     * Virtual mass of the manipulator's links. The smaller this value, the
-     * more does the end-effector (which has a unit mass of 1.0) dominate dynamic
-     * behavior. Near singularities, a bigger value leads to smoother motion.
-     */
-    std::atomic<double> m_min = 0.1;
+    ParameterSnapshot<core::ForwardDynamicsSolver::Parameters> m_parameters; ///< realtime-safe copy of the dynamic parameters
 };
 
 
@@ -43,17 +43,15 @@
 
 #include "rclcpp/node.hpp"
 #include "rclcpp_lifecycle/lifecycle_node.hpp"
+#include <cartesian_controller_base/KinematicsCache.h>
 #include <cartesian_controller_base/Utility.h>
+#include <cartesian_controller_base/core/IKSolver.h>
 #include <functional>
 #include <hardware_interface/loaned_command_interface.hpp>
 #include <hardware_interface/loaned_state_interface.hpp>
 #include <kdl/chain.hpp>
-#include <kdl/chaindynparam.hpp>
-#include <kdl/chainfksolverpos_recursive.hpp>
-#include <kdl/chainfksolvervel_recursive.hpp>
-#include <kdl/chainjnttojacsolver.hpp>
 #include <kdl/frames.hpp>
-#include <kdl/jacobian.hpp>
+#include <kdl/jntarray.hpp>
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
 #include <trajectory_msgs/msg/joint_trajectory_point.hpp>
@@ -65,11 +63,22 @@ namespace cartesian_controller_base{
  *
  *  This is a base class for solvers, whose child classes will implement
  *  different inverse kinematics algorithms.
+ *
+ *  The algorithms themselves live in \ref core::IKSolver and its children,
+ *  which know nothing about ROS.  This class adapts them to the controllers'
+ *  hardware interfaces and messages.  Child classes own their core solver,
+ *  hand it to this class' constructor and manage its parameters on the node.
  */
 class IKSolver
 {
   public:
-    IKSolver();
+    /**
+     * @brief Adapt a core solver
+     *
+     * @param solver The ROS-independent implementation.  Only its reference is
+     * stored here, so it may still be under construction.
+     */
+    explicit IKSolver(core::IKSolver& solver);
     virtual ~IKSolver();
 
     /**
@@ -78,14 +87,33 @@ class IKSolver
      * The resulting motion will be forwarded as reference to the low-level
      * joint control.
      *
+     * Implementations write into the given buffer and must not allocate
+     * memory if its positions and velocities are already sized to the number
+     * of joints.  Callers in the control loop should preallocate it once.
+     *
+     * @param period The duration in sec for this simulation step
+     * @param net_force The applied net force, expressed in the root frame
+     * @param control_cmd Holds positions and velocities of each joint on return
+     */
+    virtual void getJointControlCmds(
+        rclcpp::Duration period,
+        const ctrl::Vector6D& net_force,
+        trajectory_msgs::msg::JointTrajectoryPoint& control_cmd);
+
+    /**
+     * @brief Compute joint target commands, using specific IK algorithms
+     *
+     * Convenience wrapper that returns a new point in each call.
+     * Prefer the output buffer variant in realtime code.
+     *
      * @param period The duration in sec for this simulation step
      * @param net_force The applied net force, expressed in the root frame
      *
      * @return A point holding positions, velocities and accelerations of each joint
      */
-    virtual trajectory_msgs::msg::JointTrajectoryPoint getJointControlCmds(
+    trajectory_msgs::msg::JointTrajectoryPoint getJointControlCmds(
         rclcpp::Duration period,
-        const ctrl::Vector6D& net_force) = 0;
+        const ctrl::Vector6D& net_force);
 
     /**
      * @brief Get the current end effector pose of the simulated robot
@@ -117,6 +145,20 @@ class IKSolver
      */
     const KDL::JntArray& getPositions() const;
 
+    /**
+     * @brief Get the poses of all links of the simulated robot
+     *
+     * The poses are recomputed only if the joint positions have changed since
+     * the last call, e.g. through \ref synchronizeJointPositions().  Use this
+     * for all frame transformations within a control cycle.
+     *
+     * @return The forward kinematics for the current joint positions
+     */
+    const KinematicsCache& getKinematics();
+
+    //! The ROS-independent implementation of this solver
+    core::IKSolver& core() { return m_core; }
+
     //! Set initial joint configuration
     bool setStartState(
       const std::vector<std::reference_wrapper<hardware_interface::LoanedStateInterface> >&
@@ -139,6 +181,9 @@ class IKSolver
     /**
      * @brief Initialize the solver
      *
+     * Initializes the core solver.  Child classes declare their parameters
+     * and hand them to the core solver before calling this.
+     *
      * @param nh A handle to the node's parameter management
      * @param chain The kinematic chain of the robot
      * @param upper_pos_limits Tuple with max positive joint angles
@@ -166,37 +211,23 @@ class IKSolver
   protected:
 
     /**
-     * @brief Make sure positions stay in allowed margins
+     * @brief Copy the current joint positions and velocities into the given point
      *
-     * Limit internal joint buffers to the position limits provided by URDF.
-     * A joint will be treated as continuous, if the continuous type is set for this joint.
-     * If both upper and lower limits are zero, the joint appears fixed.  Note
-     * that this is the default urdf initializer if limits are omitted.
+     * This doesn't allocate memory if the point is already sized to the
+     * number of joints.
+     *
+     * @param period The duration for which these commands are valid
+     * @param control_cmd The point to write to
      */
-    void applyJointLimits();
-
-    //! The underlying physical system
-    KDL::Chain m_chain;
-
-    //! Number of controllable joint
-    int m_number_joints;
-
-    // Internal buffers
-    KDL::JntArray m_current_positions;
-    KDL::JntArray m_current_velocities;
-    KDL::JntArray m_current_accelerations;
-    KDL::JntArray m_last_positions;
-    KDL::JntArray m_last_velocities;
-
-    // Joint limits
-    KDL::JntArray m_upper_pos_limits;
-    KDL::JntArray m_lower_pos_limits;
-
-    // Forward kinematics
-    std::shared_ptr<KDL::ChainFkSolverPos_recursive>  m_fk_pos_solver;
-    std::shared_ptr<KDL::ChainFkSolverVel_recursive>  m_fk_vel_solver;
-    KDL::Frame      m_end_effector_pose;
-    ctrl::Vector6D  m_end_effector_vel;
+    void fillJointControlCmds(
+        const rclcpp::Duration& period,
+        trajectory_msgs::msg::JointTrajectoryPoint& control_cmd) const;
+
+  private:
+    core::IKSolver& m_core;
+
+    //! Preallocated buffer for the real robot's joint positions
+    KDL::JntArray m_measured_positions;
 };
 
 
@@ -41,7 +41,7 @@
 #define JACOBIAN_TRANSPOSE_SOLVER_H_INCLUDED
 
 #include <cartesian_controller_base/IKSolver.h>
-#include <kdl/jacobian.hpp>
+#include <cartesian_controller_base/core/JacobianTransposeSolver.h>
 #include <memory>
 
 namespace cartesian_controller_base{
@@ -49,16 +49,8 @@ namespace cartesian_controller_base{
   /**
    * \brief A Jacobian transpose IK solver for Cartesian controllers
    *
-   *
- *  The resulting joint accelerations are computed according to
- *  \f$ \ddot{q} = J^T f \f$
- *  Where \f$ J \f$ denotes the manipulator's joint Jacobian and \f$ f \f$ is
- *  the applied force to the end effector.
- *  This implements the dynamical system from Wolovich and Elliot
- *  https://ieeexplore.ieee.org/abstract/document/4048118 with \f$ \alpha = 1 \f$ with
- *  the difference that this implementation does not accumulate velocity during time integration.
- *  The system always starts anew in each control cycle with instantaneous
- *  accelerations, having the benefit that no damping is required to avoid overshooting.
+   * Plugin adapter for \ref core::JacobianTransposeSolver.  See there for
+   * the algorithm.  This solver has no parameters.
    */
 class JacobianTransposeSolver : public IKSolver
 {
@@ -66,18 +58,6 @@ class JacobianTransposeSolver : public IKSolver
     JacobianTransposeSolver();
     ~JacobianTransposeSolver();
 
-    /**
-     * \brief Compute joint target commands with the Jacobian transpose
-     *
-     * \param period The duration in sec for this simulation step
-     * \param net_force The applied net force, expressed in the root frame
-     *
-     * \return A point holding positions, velocities and accelerations of each joint
-     */
-    trajectory_msgs::msg::JointTrajectoryPoint getJointControlCmds(
-        rclcpp::Duration period,
-        const ctrl::Vector6D& net_force) override;
-
     /**
      * \brief Initialize the solver
      *
@@ -97,8 +77,7 @@ class JacobianTransposeSolver : public IKSolver
               const KDL::JntArray& lower_pos_limits) override;
 
   private:
-    std::shared_ptr<KDL::ChainJntToJacSolver> m_jnt_jacobian_solver;
-    KDL::Jacobian m_jnt_jacobian;
+    core::JacobianTransposeSolver m_solver;
 };
 
 }
@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    JointCountDispatch.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef JOINT_COUNT_DISPATCH_H_INCLUDED
+#define JOINT_COUNT_DISPATCH_H_INCLUDED
+
+#include <Eigen/Core>
+#include <atomic>
+#include <type_traits>
+
+namespace cartesian_controller_base
+{
+
+//! Compile-time number of joints, or Eigen::Dynamic
+template <int N>
+using JointCount = std::integral_constant<int, N>;
+
+namespace detail
+{
+inline std::atomic<bool>& fixedSizeKernels()
+{
+  static std::atomic<bool> enabled{true};
+  return enabled;
+}
+} // namespace detail
+
+/**
+ * @brief Enable or disable the fixed-size kernels of \ref dispatchJointCount
+ *
+ * If disabled, all chains use dynamically sized types.  This only affects
+ * solvers that are initialized afterwards, and is meant for comparing both
+ * implementations, e.g. in tests.
+ *
+ * @param enabled Whether 6 and 7 joint chains get fixed-size kernels
+ */
+inline void enableFixedSizeKernels(bool enabled)
+{
+  detail::fixedSizeKernels() = enabled;
+}
+
+/**
+ * @brief Select a fixed-size implementation for the given number of joints
+ *
+ * Solvers use this once during initialization to pick kernels that are
+ * templated on the number of joints.  Common manipulators with 6 and 7 joints
+ * get fixed-size Eigen types, which live on the stack and whose products the
+ * compiler can unroll and vectorize.  All other chains fall back to
+ * dynamically sized types.
+ *
+ * \code{.cpp}
+ * m_kernel = dispatchJointCount(n, [](auto N) { return &Solver::kernel<decltype(N)::value>; });
+ * \endcode
+ *
+ * @param number_joints The number of joints at runtime
+ * @param f Callable that takes a \ref JointCount
+ *
+ * @return What f returns
+ */
+template <class F>
+auto dispatchJointCount(int number_joints, F&& f)
+{
+  switch (detail::fixedSizeKernels() ? number_joints : Eigen::Dynamic)
+  {
+    case 6:
+      return f(JointCount<6>{});
+    case 7:
+      return f(JointCount<7>{});
+    default:
+      return f(JointCount<Eigen::Dynamic>{});
+  }
+}
+
+}
+
+#endif
@@ -0,0 +1,226 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    KinematicsCache.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef KINEMATICS_CACHE_H_INCLUDED
+#define KINEMATICS_CACHE_H_INCLUDED
+
+#include <kdl/chain.hpp>
+#include <kdl/frames.hpp>
+#include <kdl/jacobian.hpp>
+#include <kdl/jntarray.hpp>
+#include <kdl/joint.hpp>
+#include <string>
+#include <vector>
+
+namespace cartesian_controller_base
+{
+
+//! Where a segment of a chain ends up after \ref collapseFixedSegments()
+struct CollapsedSegment
+{
+  int         segment;  ///< index of the segment in the collapsed chain
+  KDL::Frame  offset;   ///< pose of the original segment's tip in the collapsed segment's tip
+};
+
+/**
+ * @brief Merge fixed segments into the preceding moving segment
+ *
+ * Flanges, tool changers and sensor mounts add fixed segments to a chain
+ * that only cost time in recursive solvers.  The collapsed chain has one
+ * segment per joint and its tips coincide with the original tips of the
+ * last segments in each group.  Fixed segments before the first joint are
+ * merged into one leading fixed segment.
+ *
+ * Not realtime-safe.
+ *
+ * @param chain The original chain
+ * @param collapsed The chain with merged fixed segments
+ *
+ * @return For each segment of the original chain, where it ends up in the
+ * collapsed chain
+ */
+std::vector<CollapsedSegment> collapseFixedSegments(const KDL::Chain& chain, KDL::Chain& collapsed);
+
+/**
+ * @brief Forward kinematics of all links in a chain, computed once per joint state
+ *
+ * The cache holds the poses of all links with respect to the chain's root
+ * and the chain's Jacobian.  Both are recomputed in a single pass over a
+ * flattened copy of the chain whenever \ref update() is called with new
+ * joint positions, and are served from memory otherwise.  Fixed segments are
+ * merged into their preceding moving segments, see \ref
+ * collapseFixedSegments(), and only the moving segments are traversed.  The
+ * links of merged segments remain addressable as anchors with constant
+ * offsets.
+ *
+ * Links are addressed by integer indices that should be resolved with \ref
+ * linkIndex() once during configuration. Index 0 is the chain's root, index
+ * i > 0 is the tip of the i-th segment.
+ *
+ * The tool center point (TCP) is the chain's tip by default and can be moved
+ * to any link with a constant offset, see \ref setTool().  The tip frame and
+ * the Jacobian refer to the TCP.
+ */
+class KinematicsCache
+{
+  public:
+    KinematicsCache();
+    ~KinematicsCache();
+
+    /**
+     * @brief Allocate buffers for the given chain
+     *
+     * Not realtime-safe.
+     *
+     * @param chain The kinematic chain
+     */
+    void init(const KDL::Chain& chain);
+
+    /**
+     * @brief Look up the index of a link
+     *
+     * Not realtime-safe.
+     *
+     * @param link The link's name
+     *
+     * @return The link's index or -1 if no segment of the chain has this name
+     */
+    int linkIndex(const std::string& link) const;
+
+    /**
+     * @brief Recompute all link poses and the Jacobian if the joint positions have changed
+     *
+     * @param positions The chain's joint positions
+     *
+     * @return True if the poses have been recomputed
+     */
+    bool update(const KDL::JntArray& positions);
+
+    //! Force recomputation in the next call to \ref update()
+    void invalidate() { m_valid = false; }
+
+    /**
+     * @brief Set the tool center point
+     *
+     * Realtime-safe.  Takes effect in the next call to \ref update().
+     *
+     * @param index The index of the TCP's parent link from \ref linkIndex()
+     * @param offset The TCP's pose in that link
+     */
+    void setTool(int index, const KDL::Frame& offset);
+
+    //! The index of the TCP's parent link
+    int getToolIndex() const { return m_tool_index; }
+
+    /**
+     * @brief Get the pose of a link with respect to the chain's root
+     *
+     * Links of merged fixed segments cost one frame multiplication.
+     *
+     * @param index The link's index from \ref linkIndex()
+     *
+     * @return The pose from the cached poses
+     */
+    KDL::Frame getFrame(int index) const
+    {
+      const Anchor& anchor = m_anchors[index];
+      return anchor.has_offset ? m_frames[anchor.frame] * anchor.offset : m_frames[anchor.frame];
+    }
+
+    //! Get the pose of the TCP with respect to the chain's root
+    const KDL::Frame& getTipFrame() const { return m_tool_frame; }
+
+    //! Number of addressable links, including the root
+    int getNrOfFrames() const { return static_cast<int>(m_anchors.size()); }
+
+    /**
+     * @brief Get the Jacobian of the TCP
+     *
+     * Same as KDL::ChainJntToJacSolver, i.e. expressed in the chain's root
+     * frame with the reference point in the TCP's origin.  Linear
+     * components come first.  Joints behind the TCP's link have zero columns.
+     *
+     * @return The cached Jacobian
+     */
+    const KDL::Jacobian& getJacobian() const { return m_jacobian; }
+
+    //! Get the axis of the j-th joint in the chain's root frame
+    const KDL::Vector& getJointAxis(int j) const { return m_joint_axes[j]; }
+
+    //! Get the origin of the j-th joint in the chain's root frame
+    const KDL::Vector& getJointOrigin(int j) const { return m_joint_origins[j]; }
+
+  private:
+    //! A chain segment, prepared for fast traversal
+    struct Element
+    {
+      KDL::Joint  joint;
+      bool        moving;
+      bool        prismatic;
+      KDL::Vector axis;    ///< joint axis in the segment's root frame
+      KDL::Vector origin;  ///< joint origin in the segment's root frame
+      KDL::Frame  tip;     ///< segment tip with respect to the joint frame
+    };
+
+    //! A link in the original chain, expressed in the cached poses
+    struct Anchor
+    {
+      int         frame;       ///< index into the cached poses
+      bool        has_offset;
+      KDL::Frame  offset;      ///< the link's pose in that frame
+    };
+
+    std::vector<Element>      m_elements;
+    std::vector<size_t>       m_joint_elements;   ///< element of each joint
+    std::vector<std::string>  m_link_names;
+    std::vector<Anchor>       m_anchors;          ///< root, then one per original segment
+    std::vector<KDL::Frame>   m_frames;
+    std::vector<KDL::Vector>  m_joint_axes;     ///< in the chain's root frame
+    std::vector<KDL::Vector>  m_joint_origins;  ///< in the chain's root frame
+    KDL::Jacobian             m_jacobian;
+    KDL::JntArray             m_positions; ///< joint positions of the cached poses
+    int                       m_tool_index;
+    KDL::Frame                m_tool_offset;
+    KDL::Frame                m_tool_frame;
+    bool                      m_valid;
+};
+
+}
+
+#endif
@@ -0,0 +1,221 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    LatencyHistogram.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef LATENCY_HISTOGRAM_H_INCLUDED
+#define LATENCY_HISTOGRAM_H_INCLUDED
+
+#include "ROS2VersionConfig.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace cartesian_controller_base
+{
+
+/**
+ * @brief A wait-free histogram of latencies with fixed buckets
+ *
+ * The realtime thread records samples with relaxed atomic increments into
+ * preallocated buckets.  A non-realtime thread periodically collects the
+ * counts and computes percentiles from them.
+ *
+ * Buckets are spaced logarithmically with four buckets per power of two
+ * nanoseconds.  This gives a relative resolution of about 20 % over the
+ * whole range from nanoseconds to hours.
+ */
+class LatencyHistogram
+{
+  public:
+    static constexpr int NUM_BUCKETS = 256;
+
+    //! Percentiles of the samples in one collection period, in microseconds
+    struct Summary
+    {
+      uint64_t count = 0;
+      double p50 = 0.0;
+      double p90 = 0.0;
+      double p99 = 0.0;
+      double max = 0.0;
+    };
+
+    LatencyHistogram()
+    {
+      for (auto& count : m_counts)
+      {
+        count.store(0, std::memory_order_relaxed);
+      }
+    }
+
+    /**
+     * @brief Add a sample
+     *
+     * Realtime-safe.  Call this from one thread only.
+     *
+     * @param latency The measured duration
+     */
+    void record(std::chrono::steady_clock::duration latency)
+    {
+      const int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count();
+      const uint64_t value = ns > 0 ? static_cast<uint64_t>(ns) : 0;
+      m_counts[bucket(value)].fetch_add(1, std::memory_order_relaxed);
+      m_last.store(value, std::memory_order_relaxed);
+      if (value > m_max.load(std::memory_order_relaxed))
+      {
+        m_max.store(value, std::memory_order_relaxed);
+      }
+    }
+
+    /**
+     * @brief Compute percentiles and start a new collection period
+     *
+     * Call this from a non-realtime thread.  Percentiles are reported as the
+     * upper bounds of their buckets.
+     *
+     * @return Percentiles of all samples since the last call
+     */
+    Summary collect()
+    {
+      std::array<uint64_t, NUM_BUCKETS> counts;
+      Summary summary;
+      for (int i = 0; i < NUM_BUCKETS; ++i)
+      {
+        counts[i] = m_counts[i].exchange(0, std::memory_order_relaxed);
+        summary.count += counts[i];
+      }
+      const uint64_t max = m_max.exchange(0, std::memory_order_relaxed);
+      if (summary.count == 0)
+      {
+        return summary;
+      }
+
+      auto percentile = [&](double fraction) {
+        const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(fraction * summary.count + 0.5));
+        uint64_t seen = 0;
+        for (int i = 0; i < NUM_BUCKETS; ++i)
+        {
+          seen += counts[i];
+          if (seen >= rank)
+          {
+            return std::min(upperBound(i), max) / 1000.0;
+          }
+        }
+        return max / 1000.0;
+      };
+      summary.p50 = percentile(0.5);
+      summary.p90 = percentile(0.9);
+      summary.p99 = percentile(0.99);
+      summary.max = max / 1000.0;
+      return summary;
+    }
+
+    //! The most recent sample in seconds
+    double last() const
+    {
+      return m_last.load(std::memory_order_relaxed) * 1e-9;
+    }
+
+  private:
+    //! Index of the bucket for the given value in nanoseconds
+    static int bucket(uint64_t ns)
+    {
+      if (ns < 4)
+      {
+        return static_cast<int>(ns);
+      }
+      const int msb = 63 - __builtin_clzll(ns);
+      const int sub = static_cast<int>((ns >> (msb - 2)) & 3);
+      return (msb - 1) * 4 + sub;
+    }
+
+    //! Smallest value in nanoseconds that falls into the next bucket
+    static uint64_t upperBound(int bucket)
+    {
+      const int next = bucket + 1;
+      if (next < 4)
+      {
+        return static_cast<uint64_t>(next);
+      }
+      const int msb = next / 4 + 1;
+      const uint64_t sub = next % 4;
+      return msb > 63 ? UINT64_MAX : (4 + sub) << (msb - 2);
+    }
+
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> m_counts;
+    std::atomic<uint64_t> m_max = {0};
+    std::atomic<uint64_t> m_last = {0};
+};
+
+/**
+ * @brief Record the lifetime of this object in a \ref LatencyHistogram
+ */
+class ScopedLatency
+{
+  public:
+    explicit ScopedLatency(LatencyHistogram& histogram)
+      : m_histogram(histogram), m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~ScopedLatency()
+    {
+      m_histogram.record(std::chrono::steady_clock::now() - m_start);
+    }
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+  private:
+    LatencyHistogram& m_histogram;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+}
+
+// Measure the rest of the enclosing scope.  Expands to nothing if the
+// latency histograms are disabled in CMake.
+#ifdef CARTESIAN_CONTROLLERS_LATENCY_HISTOGRAMS
+#define CARTESIAN_CONTROLLERS_MEASURE_LATENCY(histogram) \
+  cartesian_controller_base::ScopedLatency scoped_latency(histogram)
+#else
+#define CARTESIAN_CONTROLLERS_MEASURE_LATENCY(histogram)
+#endif
+
+#endif
@@ -44,6 +44,8 @@
 #include "ROS2VersionConfig.h"
 #include "rclcpp/rclcpp.hpp"
 #include "rclcpp_lifecycle/lifecycle_node.hpp"
+#include <cartesian_controller_base/ParameterSnapshot.h>
+#include <cartesian_controller_base/core/PDController.h>
 
 namespace cartesian_controller_base
 {
@@ -57,6 +59,8 @@ namespace cartesian_controller_base
  * The \ref _cartesian_controllers_ package builds upon a control plant that
  * already has an integrating part to eliminate steady state errors.
  * Exposing parameterization for integral gains would confuse users with unused complexity.
+ *
+ * The control law is in \ref core::PDController.
  */
 class PDController
 {
@@ -64,26 +68,24 @@ class PDController
     PDController();
     ~PDController();
 
+    //! Gain parameters
+    using Gains = core::PDController::Gains;
+
 #if defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
-    void init(const std::string& params, std::shared_ptr<rclcpp_lifecycle::LifecycleNode> handle);
+    bool init(const std::string& params, std::shared_ptr<rclcpp_lifecycle::LifecycleNode> handle);
 #else
-    void init(const std::string& params, std::shared_ptr<rclcpp::Node> handle);
+    bool init(const std::string& params, std::shared_ptr<rclcpp::Node> handle);
 #endif
 
     double operator()(const double& error, const rclcpp::Duration& period);
 
+    //! The latest gains from the parameters. Realtime-safe.
+    const Gains& getGains() { return m_gains.get(); }
+
   private:
-#if defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
-    std::shared_ptr<rclcpp_lifecycle::LifecycleNode> m_handle;
-#else
-    std::shared_ptr<rclcpp::Node> m_handle; ///< handle for dynamic parameter interaction
-#endif
     std::string m_params; ///< namespace for parameter access
-
-    // Gain parameters
-    double m_p; ///< proportional gain
-    double m_d; ///< derivative gain
-    double m_last_p_error;
+    ParameterSnapshot<Gains> m_gains; ///< realtime-safe copy of the gain parameters
+    core::PDController m_controller;
 
 };
 
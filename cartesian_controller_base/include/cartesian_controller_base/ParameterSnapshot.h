@@ -0,0 +1,249 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    ParameterSnapshot.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef PARAMETER_SNAPSHOT_H_INCLUDED
+#define PARAMETER_SNAPSHOT_H_INCLUDED
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <rcl_interfaces/msg/set_parameters_result.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <realtime_tools/realtime_buffer.h>
+#include <string>
+#include <vector>
+
+namespace cartesian_controller_base
+{
+
+/**
+ * @brief Realtime-safe access to a group of dynamic parameters
+ *
+ * Looking up parameters on the node in each control cycle is comparatively
+ * expensive and involves locking the node's parameter map.  This class keeps
+ * the values of a group of parameters in a plain, user-defined \a Config struct
+ * instead.  Parameter changes are validated in an on-set-parameters callback
+ * on the node's executor thread, and accepted changes are handed over to the
+ * control loop as a complete copy with a \a realtime_tools::RealtimeBuffer.
+ * Rejected changes are reported back to the caller, e.g. in `ros2 param set`,
+ * and the control loop keeps working with the last valid configuration.
+ *
+ * Users can still change gains during operation.
+ *
+ * @tparam Config A plain struct holding the parameter values
+ */
+template <class Config>
+class ParameterSnapshot
+{
+  public:
+    /**
+     * @brief Apply a single parameter to the given config
+     *
+     * Implementations should return false and set a human readable reason if
+     * the parameter value is invalid.  Parameters that do not belong to this
+     * config must be ignored and return true.
+     */
+    using Update = std::function<bool(const rclcpp::Parameter&, Config&, std::string&)>;
+
+    ParameterSnapshot() = default;
+
+    // The parameter callback is bound to this instance.
+    ParameterSnapshot(const ParameterSnapshot&) = delete;
+    ParameterSnapshot& operator=(const ParameterSnapshot&) = delete;
+
+    /**
+     * @brief Read initial values and register for parameter changes
+     *
+     * The parameters must already be declared on the node.
+     *
+     * @param node The node that holds the parameters
+     * @param names The parameters that make up this config
+     * @param update Assigns a parameter to the config
+     *
+     * @return True if all initial values are valid
+     */
+    template <class NodePtr>
+    bool init(const NodePtr& node, const std::vector<std::string>& names, Update update)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_update = std::move(update);
+
+      std::string reason;
+      for (const auto& name : names)
+      {
+        if (!m_update(node->get_parameter(name), m_config, reason))
+        {
+          RCLCPP_ERROR(node->get_logger(), "Invalid initial value: %s", reason.c_str());
+          return false;
+        }
+      }
+      m_buffer.initRT(m_config);
+
+      m_callback_handle = node->add_on_set_parameters_callback(
+        [this](const std::vector<rclcpp::Parameter>& parameters) {
+          return onSetParameters(parameters);
+        });
+      return true;
+    }
+
+    /**
+     * @brief Access the latest config from the control loop
+     *
+     * Call this from the realtime thread only.
+     * The reference stays valid until the next call.
+     */
+    const Config& get()
+    {
+      return *m_buffer.readFromRT();
+    }
+
+    /**
+     * @brief Access the latest config from non-realtime threads
+     *
+     * @return A copy of the most recently accepted config
+     */
+    Config getNonRT() const
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      return m_config;
+    }
+
+  private:
+    rcl_interfaces::msg::SetParametersResult onSetParameters(
+      const std::vector<rclcpp::Parameter>& parameters)
+    {
+      rcl_interfaces::msg::SetParametersResult result;
+      result.successful = true;
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+
+      // Changes are atomic. Either all of them are valid or none is applied.
+      Config config = m_config;
+      for (const auto& parameter : parameters)
+      {
+        if (!m_update(parameter, config, result.reason))
+        {
+          result.successful = false;
+          return result;
+        }
+      }
+      m_config = config;
+      m_buffer.writeFromNonRT(m_config);
+      return result;
+    }
+
+    mutable std::mutex m_mutex;
+    Config m_config;
+    Update m_update;
+    realtime_tools::RealtimeBuffer<Config> m_buffer;
+    rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr m_callback_handle;
+};
+
+/**
+ * @brief Convenience functions for implementing ParameterSnapshot::Update
+ *
+ * Each function checks the parameter's type and range, and assigns its value
+ * on success.
+ */
+namespace parameters
+{
+
+inline bool assign(const rclcpp::Parameter& parameter,
+                   double& value,
+                   std::string& reason,
+                   double lower = -std::numeric_limits<double>::infinity())
+{
+  if (parameter.get_type() != rclcpp::ParameterType::PARAMETER_DOUBLE)
+  {
+    reason = parameter.get_name() + " must be a double";
+    return false;
+  }
+  const double tmp = parameter.as_double();
+  if (!std::isfinite(tmp) || tmp < lower)
+  {
+    reason = parameter.get_name() + " must be finite";
+    if (std::isfinite(lower))
+    {
+      reason += " and >= " + std::to_string(lower);
+    }
+    return false;
+  }
+  value = tmp;
+  return true;
+}
+
+inline bool assign(const rclcpp::Parameter& parameter,
+                   int& value,
+                   std::string& reason,
+                   int lower,
+                   int upper)
+{
+  if (parameter.get_type() != rclcpp::ParameterType::PARAMETER_INTEGER)
+  {
+    reason = parameter.get_name() + " must be an integer";
+    return false;
+  }
+  const int64_t tmp = parameter.as_int();
+  if (tmp < lower || tmp > upper)
+  {
+    reason = parameter.get_name() + " must be in [" + std::to_string(lower) + ", " +
+             std::to_string(upper) + "]";
+    return false;
+  }
+  value = static_cast<int>(tmp);
+  return true;
+}
+
+inline bool assign(const rclcpp::Parameter& parameter, bool& value, std::string& reason)
+{
+  if (parameter.get_type() != rclcpp::ParameterType::PARAMETER_BOOL)
+  {
+    reason = parameter.get_name() + " must be a bool";
+    return false;
+  }
+  value = parameter.as_bool();
+  return true;
+}
+
+} // namespace parameters
+
+} // namespace cartesian_controller_base
+
+#endif
@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    RobotModel.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef ROBOT_MODEL_H_INCLUDED
+#define ROBOT_MODEL_H_INCLUDED
+
+#include <kdl/chain.hpp>
+#include <kdl/jntarray.hpp>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cartesian_controller_base
+{
+
+/**
+ * @brief Immutable kinematic data of a robot chain
+ *
+ * Controllers of the same robot in one process share an instance, see \ref
+ * loadRobotModel().
+ */
+struct RobotModel
+{
+  struct Limits
+  {
+    double lower = 0.0;
+    double upper = 0.0;
+  };
+
+  std::string description;                ///< The URDF this model was built from
+  std::string robot_base_link;
+  std::string end_effector_link;
+  KDL::Chain chain;                       ///< From \a robot_base_link to \a end_effector_link
+  std::map<std::string, Limits> limits;   ///< Of all URDF joints. NaN for continuous joints
+
+  /**
+   * @brief Look up the position limits of the given joints
+   *
+   * Non-existent URDF limits are zero.
+   *
+   * @param joint_names The actuated joints in the order of the limits
+   * @param upper_pos_limits Upper position limits of \a joint_names
+   * @param lower_pos_limits Lower position limits of \a joint_names
+   * @param error Description of what went wrong
+   *
+   * @return True on success
+   */
+  bool jointLimits(const std::vector<std::string>& joint_names,
+                   KDL::JntArray& upper_pos_limits,
+                   KDL::JntArray& lower_pos_limits,
+                   std::string& error) const;
+};
+
+/**
+ * @brief Get the kinematic model of a robot chain
+ *
+ * Parsing large URDFs is expensive.  A process-wide registry therefore hands
+ * out the same model to all callers with an identical \a robot_description
+ * and the same chain.  It only keeps weak references, so that models are
+ * freed with their last user.  Keep the returned pointer for as long as the
+ * model is in use.
+ *
+ * Thread-safe.  Not realtime-safe.
+ *
+ * @param robot_description The robot's URDF as string
+ * @param robot_base_link The chain's root link
+ * @param end_effector_link The chain's tip link
+ * @param error Description of what went wrong
+ *
+ * @return The model or nullptr on failure
+ */
+std::shared_ptr<const RobotModel> loadRobotModel(const std::string& robot_description,
+                                                 const std::string& robot_base_link,
+                                                 const std::string& end_effector_link,
+                                                 std::string& error);
+
+/**
+ * @brief Build the kinematic chain and joint limits from a URDF description
+ *
+ * Continuous joints get NaN limits.  Non-existent URDF limits are zero.
+ * This is a convenience wrapper around \ref loadRobotModel().
+ *
+ * Not realtime-safe.
+ *
+ * @param robot_description The robot's URDF as string
+ * @param robot_base_link The chain's root link
+ * @param end_effector_link The chain's tip link
+ * @param joint_names The actuated joints in the order of the limits
+ * @param chain The chain from \a robot_base_link to \a end_effector_link
+ * @param upper_pos_limits Upper position limits of \a joint_names
+ * @param lower_pos_limits Lower position limits of \a joint_names
+ * @param error Description of what went wrong
+ *
+ * @return True on success
+ */
+bool parseRobotModel(const std::string& robot_description,
+                     const std::string& robot_base_link,
+                     const std::string& end_effector_link,
+                     const std::vector<std::string>& joint_names,
+                     KDL::Chain& chain,
+                     KDL::JntArray& upper_pos_limits,
+                     KDL::JntArray& lower_pos_limits,
+                     std::string& error);
+
+}
+
+#endif
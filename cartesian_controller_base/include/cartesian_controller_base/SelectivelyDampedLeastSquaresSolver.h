@@ -41,7 +41,7 @@
 #define SELECTIVELY_DAMPED_LEAST_SQUARES_SOLVER_H_INCLUDED
 
 #include <cartesian_controller_base/IKSolver.h>
-#include <kdl/jacobian.hpp>
+#include <cartesian_controller_base/core/SelectivelyDampedLeastSquaresSolver.h>
 #include <memory>
 
 namespace cartesian_controller_base{
@@ -49,19 +49,8 @@ namespace cartesian_controller_base{
   /**
    * \brief A selectively damped least squares (SDLS) IK solver for Cartesian controllers
    *
-   *  This implements the SDLS method by Buss and Kim from 2005.
-   *
-   *  The implementation is according to their paper:
-   *  https://www.tandfonline.com/doi/abs/10.1080/2151237X.2005.10129202
-   *
-   *  which is available here:
-   *  https://www.researchgate.net/profile/Samuel_Buss/publication/220494116_Selectively_Damped_Least_Squares_for_Inverse_Kinematics/links/09e4150cc04794d9d0000000/Selectively-Damped-Least-Squares-for-Inverse-Kinematics.pdf
-   *
-   *  It has the advantage over the DLS method in that it converges faster and
-   *  does not require ad-hoc damping terms, i.e. users do not need to specify
-   *  task dependent damping values, which can otherwise require numerous
-   *  trials and expertise.  It is, however, more computationally evolved.
-   *
+   * Plugin adapter for \ref core::SelectivelyDampedLeastSquaresSolver.  See
+   * there for the algorithm.  This solver has no parameters.
    */
 class SelectivelyDampedLeastSquaresSolver : public IKSolver
 {
@@ -69,18 +58,6 @@ class SelectivelyDampedLeastSquaresSolver : public IKSolver
     SelectivelyDampedLeastSquaresSolver();
     ~SelectivelyDampedLeastSquaresSolver();
 
-    /**
-     * \brief Compute joint target commands with selectively damped least squares
-     *
-     * \param period The duration in sec for this simulation step
-     * \param net_force The applied net force, expressed in the root frame
-     *
-     * \return A point holding positions, velocities and accelerations of each joint
-     */
-    trajectory_msgs::msg::JointTrajectoryPoint getJointControlCmds(
-        rclcpp::Duration period,
-        const ctrl::Vector6D& net_force) override;
-
     /**
      * \brief Initialize the solver
      *
@@ -101,21 +78,7 @@ class SelectivelyDampedLeastSquaresSolver : public IKSolver
               const KDL::JntArray& lower_pos_limits) override;
 
   private:
-    /**
-     * @brief Helper function to clamp a column vector
-     *
-     * This literally implements ClampMaxAbs() from Buss' and Kim's paper.
-     *
-     * @param w The vector to clamp
-     * @param d The threshold for the max allowed value
-     *
-     * @return The clamped vector
-     */
-    Eigen::Matrix<double, Eigen::Dynamic, 1>
-    clampMaxAbs(const Eigen::Matrix<double, Eigen::Dynamic, 1>& w, double d);
-
-    std::shared_ptr<KDL::ChainJntToJacSolver> m_jnt_jacobian_solver;
-    KDL::Jacobian m_jnt_jacobian;
+    core::SelectivelyDampedLeastSquaresSolver m_solver;
 
 };
 
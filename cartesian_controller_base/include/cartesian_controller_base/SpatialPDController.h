@@ -42,7 +42,9 @@
 
 #include <cartesian_controller_base/PDController.h>
 #include <cartesian_controller_base/Utility.h>
+#include <cartesian_controller_base/core/PDController.h>
 #include "rclcpp_lifecycle/lifecycle_node.hpp"
+#include <array>
 
 namespace cartesian_controller_base
 {
@@ -52,6 +54,9 @@ namespace cartesian_controller_base
  *
  * This class implements separate PD controllers for each of the Cartesian
  * axes, i.e. three translational controllers and three rotational controllers.
+ *
+ * The control law is in \ref core::SpatialPDController.  This class only
+ * manages the gains as node parameters, which is why it stays with ROS.
  */
 class SpatialPDController
 {
@@ -75,8 +80,9 @@ class SpatialPDController
     ctrl::Vector6D operator()(const ctrl::Vector6D& error, const rclcpp::Duration& period);
 
   private:
-    ctrl::Vector6D m_cmd;
-    std::vector<PDController> m_pd_controllers;
+    std::array<PDController, 6> m_pd_controllers; ///< gain parameters of each axis
+    std::array<PDController::Gains, 6> m_gains;
+    core::SpatialPDController m_controller;
 
 };
 
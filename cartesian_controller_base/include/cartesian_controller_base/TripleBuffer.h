@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    TripleBuffer.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef TRIPLE_BUFFER_H_INCLUDED
+#define TRIPLE_BUFFER_H_INCLUDED
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <rclcpp/time.hpp>
+
+namespace cartesian_controller_base
+{
+
+/**
+ * @brief A wait-free single-producer, single-consumer mailbox
+ *
+ * This is the standard mechanism to hand inputs from subscriber callbacks
+ * over to the controllers' update() function.  The producer, e.g. a
+ * subscriber callback, writes complete samples and the consumer, i.e. the
+ * realtime thread, picks up the most recent one.  Intermediate samples are
+ * dropped if the producer is faster than the consumer.
+ *
+ * Three slots are used so that neither side ever waits for the other or
+ * observes a partially written sample: The producer fills its private back
+ * slot and atomically exchanges it with the shared middle slot.  The consumer
+ * atomically exchanges its private front slot with the middle slot whenever
+ * a new sample has been published.
+ *
+ * Neither side allocates memory if copy-assigning \a T doesn't.
+ *
+ * @tparam T The type of data to exchange
+ */
+template <typename T>
+class TripleBuffer
+{
+  public:
+    struct Sample
+    {
+      T data{};
+      uint64_t sequence = 0; ///< Number of this sample. Zero if nothing was written yet
+      rclcpp::Time stamp;    ///< When the producer received the data
+    };
+
+    TripleBuffer() : m_middle(encode(1, false))
+    {
+    }
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /**
+     * @brief Publish a new sample
+     *
+     * Call this from the producer thread only.
+     *
+     * @param data The data to publish
+     * @param stamp When the data was received
+     */
+    void write(const T& data, const rclcpp::Time& stamp)
+    {
+      Sample& back = m_samples[m_back];
+      back.data = data;
+      back.sequence = ++m_sequence;
+      back.stamp = stamp;
+
+      // Make the back slot the new middle slot and reuse the previous one.
+      const uint8_t previous = m_middle.exchange(encode(m_back, true), std::memory_order_acq_rel);
+      m_back = index(previous);
+    }
+
+    /**
+     * @brief Pick up the most recent sample if there is one
+     *
+     * Call this from the consumer thread only.
+     *
+     * @return True if a new sample is available in \ref latest()
+     */
+    bool read()
+    {
+      if (!isNew(m_middle.load(std::memory_order_acquire)))
+      {
+        return false;
+      }
+      const uint8_t previous = m_middle.exchange(encode(m_front, false), std::memory_order_acq_rel);
+      m_front = index(previous);
+      return true;
+    }
+
+    /**
+     * @brief The sample that the consumer picked up last
+     *
+     * Call this from the consumer thread only.
+     * The content is stable until the next call of \ref read().
+     */
+    const Sample& latest() const
+    {
+      return m_samples[m_front];
+    }
+
+  private:
+    static constexpr uint8_t encode(uint8_t index, bool is_new)
+    {
+      return static_cast<uint8_t>(index | (is_new ? 0x4 : 0x0));
+    }
+    static constexpr uint8_t index(uint8_t state) { return state & 0x3; }
+    static constexpr bool isNew(uint8_t state) { return state & 0x4; }
+
+    std::array<Sample, 3> m_samples;
+
+    // Index of the shared slot and whether it holds unread data
+    std::atomic<uint8_t> m_middle;
+
+    // Owned by the consumer
+    uint8_t m_front = 0;
+
+    // Owned by the producer
+    uint8_t m_back = 2;
+    uint64_t m_sequence = 0;
+};
+
+} // namespace cartesian_controller_base
+
+#endif
@@ -42,10 +42,20 @@
 
 #include "ROS2VersionConfig.h"
 #include "rclcpp_lifecycle/lifecycle_node.hpp"
+#include <cartesian_controller_base/FlightRecorder.h>
 #include <cartesian_controller_base/IKSolver.h>
+#include <cartesian_controller_base/LatencyHistogram.h>
+#include <cartesian_controller_base/ParameterSnapshot.h>
+#include <cartesian_controller_base/RobotModel.h>
 #include <cartesian_controller_base/SpatialPDController.h>
+#include <cartesian_controller_base/TripleBuffer.h>
 #include <cartesian_controller_base/Utility.h>
+#include <cartesian_controller_base/core/CommandExtrapolator.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <controller_interface/controller_interface.hpp>
+#include <diagnostic_updater/diagnostic_updater.hpp>
 #include <functional>
 #include <geometry_msgs/msg/pose_stamped.hpp>
 #include <geometry_msgs/msg/twist_stamped.hpp>
@@ -53,12 +63,14 @@
 #include <std_msgs/msg/string.hpp>
 #include <hardware_interface/loaned_command_interface.hpp>
 #include <hardware_interface/loaned_state_interface.hpp>
-#include <kdl/treefksolverpos_recursive.hpp>
 #include <memory>
+#include <mutex>
 #include <pluginlib/class_loader.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <realtime_tools/realtime_publisher.h>
+#include <sensor_msgs/msg/joint_state.hpp>
 #include <string>
+#include <thread>
 #include <trajectory_msgs/msg/joint_trajectory_point.hpp>
 #include <vector>
 
@@ -79,7 +91,7 @@ class CartesianControllerBase : public controller_interface::ControllerInterface
 {
   public:
     CartesianControllerBase();
-    virtual ~CartesianControllerBase(){};
+    virtual ~CartesianControllerBase();
 
     virtual controller_interface::InterfaceConfiguration command_interface_configuration() const override;
 
@@ -122,25 +134,156 @@ class CartesianControllerBase : public controller_interface::ControllerInterface
      */
     void computeJointControlCmds(const ctrl::Vector6D& error, const rclcpp::Duration& period);
 
+    /**
+     * @brief Fill in the joint control commands between decimated solver cycles
+     *
+     * With `solver.decimation` = N > 1, the solver only runs in every N-th
+     * control cycle.  In the cycles between, this extrapolates the last
+     * solver outputs in joint space with the polynomial order given by
+     * `solver.interpolation_order`.  Call this once per control cycle, before
+     * the solver, and skip the solver if it returns true.
+     *
+     * Realtime-safe.
+     *
+     * @return True if this cycle's commands have been extrapolated, false if
+     * the solver should run
+     */
+    bool extrapolateJointControlCmds();
+
+    //! How many reloaded robot models the control loop has swapped in, see \ref applyRobotModel()
+    size_t modelSwapCount() const { return m_model_swap_count; }
+
+    /**
+     * @brief Switch to the most recent tool center point from `<name>/tool_frame`
+     *
+     * Only replaces the final fixed transform of the IK solver's kinematics.
+     * Call this once per control cycle, right after synchronizing the joint
+     * positions.  The end-effector pose then refers to the new TCP.
+     *
+     * Realtime-safe.
+     *
+     * @return True if the TCP has changed in this cycle
+     */
+    bool applyToolFrame();
+
+    //! When the current tool center point was received
+    const rclcpp::Time& toolFrameStamp() const { return m_tool_frame_buffer.latest().stamp; }
+
+    //! How many tool center points have been received, e.g. to detect switches outside the control loop
+    uint64_t toolFrameCount() const { return m_tool_frame_count; }
+
+    /**
+     * @brief Compute control steps until the error has converged
+     *
+     * Calls \ref computeJointControlCmds at least once and at most
+     * `solver.iterations` times.  Stops early once the error's norm drops
+     * below `solver.convergence.error_threshold` or the norm of the simulated
+     * joint velocities drops below `solver.convergence.velocity_threshold`.
+     * Thresholds of zero disable the respective check.
+     *
+     * With a `solver.time_budget` > 0, each step's cost is measured with a
+     * monotonic clock and the iteration also stops before the next step would
+     * exceed that fraction of the control period.  Such cycles count as
+     * degraded.
+     *
+     * @param compute_error Callable that returns the current error to minimize
+     * @param period The period for each control step
+     * @param control_period The period of the outer control cycle
+     *
+     * @return The number of control steps used
+     */
+    template <class ErrorFunction>
+    int iterateJointControlCmds(ErrorFunction compute_error,
+                                const rclcpp::Duration& period,
+                                const rclcpp::Duration& control_period)
+    {
+      return iterateJointControlCmds(compute_error, period, control_period, m_iterations);
+    }
+
+    /**
+     * @brief Compute at most the given number of control steps
+     *
+     * Same as above, but for controllers with their own iteration count,
+     * such as the force controller with a single step.
+     *
+     * @param compute_error Callable that returns the current error to minimize
+     * @param period The period for each control step
+     * @param control_period The period of the outer control cycle
+     * @param max_iterations The maximum number of control steps
+     *
+     * @return The number of control steps used
+     */
+    template <class ErrorFunction>
+    int iterateJointControlCmds(ErrorFunction compute_error,
+                                const rclcpp::Duration& period,
+                                const rclcpp::Duration& control_period,
+                                int max_iterations)
+    {
+      using Clock = std::chrono::steady_clock;
+      const Clock::time_point start = Clock::now();
+      const Clock::duration budget = timeBudget(control_period);
+      Clock::duration elapsed = Clock::duration::zero();
+      Clock::duration max_step = Clock::duration::zero();
+
+      int iterations = 0;
+      bool converged = false;
+      bool out_of_time = false;
+      while (iterations < max_iterations && !converged && !out_of_time)
+      {
+        ctrl::Vector6D error;
+        {
+          CARTESIAN_CONTROLLERS_MEASURE_LATENCY(m_latencies[ERROR_COMPUTATION]);
+          error = compute_error();
+        }
+        computeJointControlCmds(error, period);
+        converged = hasConverged(error);
+        ++iterations;
+
+        // Stop if the most expensive step so far wouldn't fit in once more
+        const Clock::duration now = Clock::now() - start;
+        max_step = std::max(max_step, now - elapsed);
+        elapsed = now;
+        out_of_time = budget > Clock::duration::zero() && elapsed + max_step > budget;
+      }
+
+      const bool degraded = out_of_time && !converged && iterations < max_iterations;
+      const bool overrun = budget > Clock::duration::zero() && elapsed > budget;
+      recordIterations(iterations, converged, degraded, overrun, elapsed);
+      return iterations;
+    }
+
+    /**
+     * @brief Resolve a link name for the frame transformations below
+     *
+     * Call this once during configuration and use the index in the control
+     * cycle.
+     *
+     * @param link The link's name
+     *
+     * @return The link's index or -1 if it's neither the robot base link nor
+     * part of the robot chain
+     */
+    int linkIndex(const std::string& link);
+
     /**
      * @brief Display the given vector in the given robot base link
      *
      * @param vector The quantity to transform
-     * @param from The reference frame where the quantity was formulated
+     * @param from The reference frame where the quantity was formulated, see \ref linkIndex
      *
      * @return The quantity in the robot base frame
      */
-    ctrl::Vector6D displayInBaseLink(const ctrl::Vector6D& vector, const std::string& from);
+    ctrl::Vector6D displayInBaseLink(const ctrl::Vector6D& vector, int from);
 
     /**
      * @brief Display the given tensor in the robot base frame
      *
      * @param tensor The quantity to transform
-     * @param from The reference frame where the quantity was formulated
+     * @param from The reference frame where the quantity was formulated, see \ref linkIndex
      *
      * @return The quantity in the robot base frame
      */
-    ctrl::Matrix6D displayInBaseLink(const ctrl::Matrix6D& tensor, const std::string& from);
+    ctrl::Matrix6D displayInBaseLink(const ctrl::Matrix6D& tensor, int from);
 
     /**
      * @brief Display a given vector in a new reference frame
@@ -148,11 +291,11 @@ class CartesianControllerBase : public controller_interface::ControllerInterface
      * The vector is assumed to be given in the robot base frame.
      *
      * @param vector The quantity to transform
-     * @param to The reference frame in which to formulate the quantity
+     * @param to The reference frame in which to formulate the quantity, see \ref linkIndex
      *
      * @return The quantity in the new frame
      */
-    ctrl::Vector6D displayInTipLink(const ctrl::Vector6D& vector, const std::string& to);
+    ctrl::Vector6D displayInTipLink(const ctrl::Vector6D& vector, int to);
 
     /**
      * @brief Check if specified links are part of the robot chain
@@ -175,7 +318,27 @@ class CartesianControllerBase : public controller_interface::ControllerInterface
 
     KDL::Chain m_robot_chain;
 
-    std::shared_ptr<KDL::TreeFkSolverPos_recursive> m_forward_kinematics_solver;
+    //! Shared with other controllers of this robot, see \ref loadRobotModel()
+    std::shared_ptr<const RobotModel> m_robot_model;
+
+    //! Stages of the control cycle with latency measurements
+    enum LatencyStage
+    {
+      JOINT_STATE_SYNC,
+      ERROR_COMPUTATION,
+      SOLVER_STEP,
+      KINEMATICS_UPDATE,
+      COMMAND_WRITE,
+      NUM_LATENCY_STAGES
+    };
+
+#ifdef CARTESIAN_CONTROLLERS_LATENCY_HISTOGRAMS
+    //! Record with \ref CARTESIAN_CONTROLLERS_MEASURE_LATENCY
+    std::array<LatencyHistogram, NUM_LATENCY_STAGES> m_latencies;
+#endif
+
+    //! Opt-in recording of each cycle.  Child classes set their inputs.
+    FlightRecorder m_flight_recorder;
 
     /**
      * @brief Allow users to choose the IK solver type on startup
@@ -186,7 +349,9 @@ class CartesianControllerBase : public controller_interface::ControllerInterface
     // Dynamic parameters
     std::string m_end_effector_link;
     std::string m_robot_base_link;
+    int m_end_effector_index = {-1};
     int m_iterations;
+    int m_decimation;
 
     std::vector<std::reference_wrapper<hardware_interface::LoanedStateInterface> >
       m_joint_state_pos_handles;
@@ -204,6 +369,54 @@ class CartesianControllerBase : public controller_interface::ControllerInterface
       }
     }
 
+    /**
+     * @brief Follow the real robot while inactive
+     *
+     * Inactive controllers have no state interfaces.  With `hot_standby`
+     * enabled, they buffer the latest joint positions and velocities from
+     * `/joint_states` instead.  Activation hands them to the internal model,
+     * so that the first commands continue the robot's current motion without
+     * a transient.
+     */
+    void jointStateCallback(const sensor_msgs::msg::JointState::SharedPtr state);
+
+    /**
+     * @brief Reload robot descriptions from \ref robot_description_callback
+     *
+     * Runs on \ref m_reload_thread for the controller's lifetime.  Also
+     * releases the previous model and solver after each swap.
+     */
+    void runReloadThread();
+
+    /**
+     * @brief Build a new robot model and solver from a robot description
+     *
+     * Runs on \ref m_reload_thread.  The new model must have the same
+     * segments and joints as the current one, so that the controllers' link
+     * indices and joint handles remain valid.  A compatible model is handed
+     * over to the control loop with a fully initialized IK solver.
+     *
+     * @param robot_description The new URDF
+     */
+    void reloadRobotModel(const std::string& robot_description);
+
+    /**
+     * @brief Swap in a reloaded robot model at the end of a control cycle
+     *
+     * Realtime safe.  The new solver continues from the current joint state.
+     * The previous model and solver are released later by the reload thread.
+     */
+    void applyRobotModel();
+
+    /**
+     * @brief Receive a new tool center point
+     *
+     * The header's frame_id names the TCP's parent link, which can be any
+     * link in the chain.  An empty frame_id means `end_effector_link`.  The
+     * pose is the TCP's offset in that link.
+     */
+    void toolFrameCallback(const geometry_msgs::msg::PoseStamped::SharedPtr tool);
+
     /**
      * @brief Publish the controller's end-effector pose and twist
      *
@@ -215,11 +428,94 @@ class CartesianControllerBase : public controller_interface::ControllerInterface
      */
     void publishStateFeedback();
 
+    /**
+     * @brief Complete this cycle's sample in the flight recorder and commit it
+     *
+     * Realtime-safe.
+     */
+    void recordFlightData();
+
+    //! Write the current tool center point to the flight recorder's sample
+    void recordToolFrame();
+
+    /**
+     * @brief Check the convergence thresholds after a control step
+     *
+     * @param error The error of the last control step
+     *
+     * @return True if any of the enabled thresholds is met
+     */
+    bool hasConverged(const ctrl::Vector6D& error);
+
+    /**
+     * @brief The time available for the internal iterations
+     *
+     * @param control_period The period of the outer control cycle
+     *
+     * @return The budget or zero if disabled
+     */
+    std::chrono::steady_clock::duration timeBudget(const rclcpp::Duration& control_period);
+
+    /**
+     * @brief Update the solver statistics for diagnostics
+     *
+     * Realtime-safe.
+     *
+     * @param iterations The number of control steps in this cycle
+     * @param converged Whether the iteration stopped early
+     * @param degraded Whether the time budget stopped the iteration early
+     * @param overrun Whether the iteration took longer than the time budget
+     * @param elapsed The time spent in this cycle's iteration
+     */
+    void recordIterations(int iterations,
+                          bool converged,
+                          bool degraded,
+                          bool overrun,
+                          std::chrono::steady_clock::duration elapsed);
+
+    /**
+     * @brief Report the solver statistics since the last report
+     *
+     * Runs periodically in the node's executor.
+     */
+    void produceSolverDiagnostics(diagnostic_updater::DiagnosticStatusWrapper& status);
+
+#ifdef CARTESIAN_CONTROLLERS_LATENCY_HISTOGRAMS
+    /**
+     * @brief Report latency percentiles of each stage since the last report
+     *
+     * Runs periodically in the node's executor.
+     */
+    void produceLatencyDiagnostics(diagnostic_updater::DiagnosticStatusWrapper& status);
+#endif
+
     realtime_tools::RealtimePublisherSharedPtr<geometry_msgs::msg::PoseStamped>
       m_feedback_pose_publisher;
     realtime_tools::RealtimePublisherSharedPtr<geometry_msgs::msg::TwistStamped>
       m_feedback_twist_publisher;
 
+    std::shared_ptr<diagnostic_updater::Updater> m_diagnostics;
+
+    // Solver statistics since the last diagnostics report
+    std::atomic<int>      m_last_iterations = {0};
+    std::atomic<int>      m_max_iterations = {0};
+    std::atomic<uint64_t> m_cycles = {0};
+    std::atomic<uint64_t> m_total_iterations = {0};
+    std::atomic<uint64_t> m_converged_cycles = {0};
+    std::atomic<int64_t>  m_max_elapsed_ns = {0};
+
+    // Time budget statistics since configuration
+    std::atomic<uint64_t> m_degraded_cycles = {0};
+    std::atomic<uint64_t> m_budget_overruns = {0};
+    uint64_t              m_reported_budget_overruns = {0};  ///< diagnostics only
+
+    // Decimated solver cycles
+    core::CommandExtrapolator m_extrapolator;
+    int                       m_decimation_counter = {0};
+    bool                      m_solver_cycle = {true};
+    std::atomic<uint64_t>     m_solver_cycles = {0};
+    std::chrono::steady_clock::time_point m_last_solver_report;  ///< diagnostics only
+
     std::vector<std::string> m_cmd_interface_types;
     std::vector<std::reference_wrapper<hardware_interface::LoanedCommandInterface>> m_joint_cmd_pos_handles;
     std::vector<std::reference_wrapper<hardware_interface::LoanedCommandInterface>> m_joint_cmd_vel_handles;
@@ -234,8 +530,61 @@ class CartesianControllerBase : public controller_interface::ControllerInterface
     bool m_configured = {false};
     bool m_active = {false};
 
+    // Hot standby
+    rclcpp::Subscription<sensor_msgs::msg::JointState>::SharedPtr m_joint_state_subscription;
+    std::mutex    m_standby_mutex;  ///< Between joint state callbacks and activation
+    KDL::JntArray m_standby_positions;
+    KDL::JntArray m_standby_velocities;
+    rclcpp::Time  m_standby_stamp;
+    bool          m_standby_synchronized = {false};
+
+    // Robot model reload.  The reload thread owns m_model_swap unless
+    // m_model_swap_state is SWAP_READY or SWAP_BUSY.
+    enum ModelSwapState
+    {
+      SWAP_IDLE,   ///< Nothing pending
+      SWAP_READY,  ///< New model and solver waiting for the control loop
+      SWAP_BUSY,   ///< Control loop is swapping
+      SWAP_DONE    ///< Previous model and solver waiting for release
+    };
+    struct ModelSwap
+    {
+      std::shared_ptr<const RobotModel> robot_model;
+      std::shared_ptr<IKSolver> ik_solver;
+    };
+    std::atomic<bool> m_reload_robot_description = {false};
+    std::string       m_ik_solver_name;
+    std::thread       m_reload_thread;
+    std::mutex        m_reload_mutex;
+    std::condition_variable m_reload_wakeup;
+    std::string       m_reload_description;  ///< Pending update, empty if none
+    bool              m_reload_stop = {false};
+    ModelSwap         m_model_swap;
+    std::atomic<int>  m_model_swap_state = {SWAP_IDLE};
+    size_t            m_model_swap_count = {0};  ///< used by the control loop
+
+    // Tool center point
+    struct ToolFrame
+    {
+      int link = {-1};  ///< see \ref linkIndex()
+      KDL::Frame offset;
+    };
+    rclcpp::Subscription<geometry_msgs::msg::PoseStamped>::SharedPtr m_tool_frame_subscription;
+    TripleBuffer<ToolFrame> m_tool_frame_buffer;
+    ToolFrame               m_tool_frame;  ///< used by the control loop
+    std::atomic<uint64_t>   m_tool_frame_count = {0};
+
     // Dynamic parameters
-    double m_error_scale;
+    struct SolverParameters
+    {
+      double error_scale = 1.0;
+      bool publish_state_feedback = false;
+      double convergence_error_threshold = 0.0;
+      double convergence_velocity_threshold = 0.0;
+      double time_budget = 0.0;
+      int interpolation_order = 1;
+    };
+    ParameterSnapshot<SolverParameters> m_solver_parameters;
     std::string m_robot_description;
 
     // Define a subscriber and a callback to get robot description from robot_state_publisher
@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    ArticulatedBodySolver.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef CORE_ARTICULATED_BODY_SOLVER_H_INCLUDED
+#define CORE_ARTICULATED_BODY_SOLVER_H_INCLUDED
+
+#include <cartesian_controller_base/Utility.h>
+#include <cartesian_controller_base/core/IKSolver.h>
+#include <Eigen/StdVector>
+#include <vector>
+
+namespace cartesian_controller_base{
+namespace core{
+
+/*! \brief Forward dynamics IK solver with linear complexity
+ *
+ *  This solver simulates the same virtually conditioned system as the \ref
+ *  ForwardDynamicsSolver, i.e.
+ *  \f$ \ddot{q} = H^{-1} ( J^T f) \f$
+ *  with the same generic link masses, but without forming and decomposing the
+ *  joint space inertia matrix \f$ H \f$.  Instead, it uses Featherstone's
+ *  articulated-body algorithm, which scales linearly with the number of
+ *  joints.
+ *
+ *  All spatial quantities are expressed in the robot base frame with respect
+ *  to its origin, with linear components first.  The robot is at rest in
+ *  each step, so there are no velocity-dependent forces, as in the \ref
+ *  ForwardDynamicsSolver.
+ */
+class ArticulatedBodySolver : public IKSolver
+{
+  public:
+    //! Configuration
+    struct Parameters
+    {
+      /**
+       * Virtual link mass
+       * Virtual mass of the manipulator's links. The smaller this value, the
+       * more does the end-effector (which has a unit mass of 1.0) dominate dynamic
+       * behavior. Near singularities, a bigger value leads to smoother motion.
+       * Must be > 0.
+       */
+      double link_mass = 0.1;
+    };
+
+    ArticulatedBodySolver();
+    ~ArticulatedBodySolver();
+
+    /**
+     * @brief Compute joint target commands with approximate forward dynamics
+     *
+     * @param period The duration in sec for this simulation step
+     * @param net_force The applied net force, expressed in the root frame
+     */
+    void computeJointControlCmds(double period, const ctrl::Vector6D& net_force) override;
+
+    /**
+     * @brief Initialize the solver
+     *
+     * @return False for chains without joints
+     */
+    bool init(const KDL::Chain& chain,
+              const KDL::JntArray& upper_pos_limits,
+              const KDL::JntArray& lower_pos_limits) override;
+
+    //! Set the configuration. Realtime-safe.
+    void setParameters(const Parameters& parameters) { m_parameters = parameters; }
+
+    const Parameters& getParameters() const { return m_parameters; }
+
+  private:
+    template <class T>
+    using AlignedVector = std::vector<T, Eigen::aligned_allocator<T> >;
+
+    /**
+     * @brief Build a generic robot model for control
+     *
+     * Uses the same masses and inertias as the \ref ForwardDynamicsSolver.
+     *
+     * @param link_mass The virtual mass of each moving link
+     */
+    void buildGenericModel(double link_mass);
+
+    /**
+     * @brief Compute joint accelerations for the given end effector wrench
+     *
+     * @param net_force The applied net force, expressed in the root frame
+     */
+    void computeJointAccelerations(const ctrl::Vector6D& net_force);
+
+    // Generic model, one entry per segment
+    std::vector<double> m_segment_mass;
+    std::vector<double> m_segment_inertia;  ///< isotropic rotational inertia about the segment's tip
+    std::vector<int>    m_segment_body;     ///< moving body a segment is attached to, -1 for the base
+    std::vector<bool>   m_joint_prismatic;
+    double              m_model_link_mass = {0.0}; ///< link mass of the current generic model
+
+    // Articulated-body buffers, one entry per joint
+    AlignedVector<ctrl::Matrix6D> m_articulated_inertia;
+    AlignedVector<ctrl::Vector6D> m_bias_force;
+    AlignedVector<ctrl::Vector6D> m_motion_subspace;
+    AlignedVector<ctrl::Vector6D> m_U;
+    ctrl::VectorND                m_D;
+    ctrl::VectorND                m_u;
+
+    Parameters m_parameters;
+};
+
+} // namespace core
+} // namespace cartesian_controller_base
+
+#endif
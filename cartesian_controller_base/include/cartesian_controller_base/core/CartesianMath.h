@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    CartesianMath.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef CORE_CARTESIAN_MATH_H_INCLUDED
+#define CORE_CARTESIAN_MATH_H_INCLUDED
+
+#include <cartesian_controller_base/Utility.h>
+#include <kdl/frames.hpp>
+
+namespace cartesian_controller_base
+{
+namespace core
+{
+
+/**
+ * @brief Compute the motion error = target - current
+ *
+ * Translation and orientation are clamped to a maximal distance of 1 m and
+ * a maximal angle of 1 rad, respectively.  The orientation error is a
+ * Rodrigues vector.
+ *
+ * @param target The target pose
+ * @param current The current pose in the same reference frame
+ *
+ * @return The error, first translation, then rotation
+ */
+ctrl::Vector6D computeMotionError(const KDL::Frame& target, const KDL::Frame& current);
+
+/**
+ * @brief Rotate a Cartesian vector, e.g. a wrench or twist
+ *
+ * @param rotation The rotation to apply to both the linear and angular part
+ * @param vector The quantity to rotate
+ *
+ * @return The rotated quantity
+ */
+ctrl::Vector6D rotate(const KDL::Rotation& rotation, const ctrl::Vector6D& vector);
+
+/**
+ * @brief Rotate the diagonal blocks of a Cartesian tensor
+ *
+ * Each diagonal 3x3 block is treated as an individual 2nd rank tensor.  The
+ * off-diagonal blocks of the result are zero.
+ *
+ * @param rotation The rotation to apply
+ * @param tensor The quantity to rotate, e.g. a stiffness
+ *
+ * @return The rotated quantity
+ */
+ctrl::Matrix6D rotate(const KDL::Rotation& rotation, const ctrl::Matrix6D& tensor);
+
+//! Configuration of \ref computeForceError()
+struct ForceErrorParameters
+{
+  /**
+   * Allow users to choose whether to specify their target wrenches in the
+   * end-effector frame (= True) or the base frame (= False). The first one
+   * is easier for explicit task programming, while the second one is more
+   * intuitive for tele-manipulation.
+   */
+  bool hand_frame_control = true;
+};
+
+/**
+ * @brief Compute the net force of target wrench and measured sensor wrench
+ *
+ * @param parameters The configuration
+ * @param target_wrench The target wrench, in the end effector or base frame
+ * @param ft_sensor_wrench The measured wrench in the sensor's reference frame
+ * @param end_effector_rotation The orientation of the end effector in the base frame
+ * @param ft_sensor_rotation The orientation of the sensor's reference frame in the base frame
+ *
+ * @return The remaining error wrench, given in the base frame
+ */
+ctrl::Vector6D computeForceError(const ForceErrorParameters& parameters,
+                                 const ctrl::Vector6D& target_wrench,
+                                 const ctrl::Vector6D& ft_sensor_wrench,
+                                 const KDL::Rotation& end_effector_rotation,
+                                 const KDL::Rotation& ft_sensor_rotation);
+
+//! Configuration of \ref computeComplianceError()
+struct ComplianceErrorParameters
+{
+  ctrl::Vector6D stiffness = ctrl::Vector6D::Zero(); ///< (linear, angular)
+};
+
+/**
+ * @brief Compute the net force of a force error and a stiffness-related pose offset
+ *
+ * @param parameters The configuration
+ * @param motion_error The pose offset in the base frame, see \ref computeMotionError()
+ * @param force_error The net force in the base frame, see \ref computeForceError()
+ * @param compliance_ref_rotation The orientation of the stiffness' reference frame in the base frame
+ *
+ * @return The remaining error wrench, given in the base frame
+ */
+ctrl::Vector6D computeComplianceError(const ComplianceErrorParameters& parameters,
+                                      const ctrl::Vector6D& motion_error,
+                                      const ctrl::Vector6D& force_error,
+                                      const KDL::Rotation& compliance_ref_rotation);
+
+} // namespace core
+} // namespace cartesian_controller_base
+
+#endif
@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    CartesianSpline.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef CORE_CARTESIAN_SPLINE_H_INCLUDED
+#define CORE_CARTESIAN_SPLINE_H_INCLUDED
+
+#include <Eigen/Geometry>
+#include <kdl/frames.hpp>
+#include <string>
+#include <vector>
+
+namespace cartesian_controller_base
+{
+namespace core
+{
+
+/**
+ * @brief A smooth Cartesian trajectory through timed waypoints
+ *
+ * Positions are interpolated with cubic Hermite splines.  The tangents are
+ * the mean of the adjacent secant slopes, and zero in the first and last
+ * waypoint, so that the translation starts and ends at rest.  Orientations
+ * are interpolated with spherical quadrangle interpolation (SQUAD), which is
+ * the rotational counterpart with a continuous angular velocity.
+ *
+ * If the first waypoint is later than the trajectory's start, the
+ * trajectory begins with an implicit waypoint at time zero.  \ref setStart()
+ * moves it to the robot's pose when the trajectory is picked up.
+ *
+ * All coefficients are computed once in \ref init(), so that \ref evaluate()
+ * is cheap and doesn't allocate memory.  Before the start and after the last
+ * waypoint, the trajectory holds the respective pose.
+ */
+class CartesianSpline
+{
+  public:
+    struct Waypoint
+    {
+      double time = 0.0; ///< Seconds since the trajectory's start
+      KDL::Frame pose;
+    };
+
+    CartesianSpline();
+
+    /**
+     * @brief Compute the spline coefficients
+     *
+     * Not realtime-safe.
+     *
+     * @param waypoints At least one waypoint with strictly increasing times
+     * @param error A description of what went wrong on failure
+     *
+     * @return True on success
+     */
+    bool init(const std::vector<Waypoint>& waypoints, std::string& error);
+
+    /**
+     * @brief Start the trajectory from the given pose
+     *
+     * Sets the implicit waypoint at time zero and updates the adjacent
+     * segments.  Until then, it has the first waypoint's pose.  No-op if
+     * the first waypoint is at or before time zero.
+     *
+     * Realtime-safe.
+     *
+     * @param pose Where the trajectory starts, usually the current pose
+     */
+    void setStart(const KDL::Frame& pose);
+
+    /**
+     * @brief Sample the trajectory
+     *
+     * Realtime-safe.
+     *
+     * @param time Seconds since the trajectory's start
+     * @param segment The segment of the previous call to speed up the search.
+     * Start with zero.
+     *
+     * @return The interpolated pose
+     */
+    KDL::Frame evaluate(double time, size_t& segment) const;
+
+    //! Seconds from the start until the last waypoint
+    double duration() const { return m_end_time; }
+
+  private:
+    //! Hermite tangent and SQUAD control point of the given waypoint
+    void computeTangent(size_t i);
+
+    //! Coefficients of the segment from the given waypoint to the next one
+    void computeSegment(size_t i);
+
+    struct Segment
+    {
+      double start;
+      double duration;
+
+      // Position in the segment's normalized time s in [0, 1]:
+      // p(s) = c0 + c1 s + c2 s^2 + c3 s^3
+      Eigen::Vector3d c0, c1, c2, c3;
+
+      // Orientations and SQUAD control points at both ends
+      Eigen::Quaterniond q0, q1, a0, a1;
+    };
+
+    // Waypoints, including the implicit start
+    std::vector<double> m_times;
+    std::vector<Eigen::Vector3d> m_positions;
+    std::vector<Eigen::Quaterniond> m_orientations;
+    std::vector<Eigen::Vector3d> m_tangents;
+    std::vector<Eigen::Quaterniond> m_controls;
+    bool m_implicit_start = {false};
+
+    std::vector<Segment> m_segments;
+    KDL::Frame m_first;
+    KDL::Frame m_last;
+    double m_start_time = {0.0};
+    double m_end_time = {0.0};
+};
+
+} // namespace core
+} // namespace cartesian_controller_base
+
+#endif
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    CommandExtrapolator.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef CORE_COMMAND_EXTRAPOLATOR_H_INCLUDED
+#define CORE_COMMAND_EXTRAPOLATOR_H_INCLUDED
+
+#include <array>
+#include <kdl/jntarray.hpp>
+#include <vector>
+
+namespace cartesian_controller_base
+{
+namespace core
+{
+
+/**
+ * @brief Joint space extrapolation of decimated solver outputs
+ *
+ * When the IK solver runs only every few control cycles, this class fills
+ * in the joint commands of the cycles in between.  It keeps the last three
+ * solver outputs and extrapolates a polynomial through them:
+ *
+ * - order 0 holds the last output
+ * - order 1 continues with the step between the last two outputs
+ * - order 2 additionally continues with the change of that step
+ *
+ * Time is measured in solver cycles, i.e. 0 is the last output and 1 is
+ * where the next one is expected.  Positions are clamped to the joint
+ * limits.
+ */
+class CommandExtrapolator
+{
+  public:
+    static constexpr int MAX_ORDER = 2;
+
+    CommandExtrapolator();
+
+    /**
+     * @brief Allocate the history for the given joints
+     *
+     * Not realtime-safe.
+     *
+     * @param upper_pos_limits Max positive joint angles. NaN for continuous joints
+     * @param lower_pos_limits Max negative joint angles. NaN for continuous joints
+     */
+    void init(const KDL::JntArray& upper_pos_limits, const KDL::JntArray& lower_pos_limits);
+
+    /**
+     * @brief Start at rest in the given solver output
+     *
+     * Realtime-safe.
+     */
+    void reset(const std::vector<double>& positions, const std::vector<double>& velocities);
+
+    /**
+     * @brief Add the latest solver output
+     *
+     * Realtime-safe.
+     */
+    void push(const std::vector<double>& positions, const std::vector<double>& velocities);
+
+    /**
+     * @brief Extrapolate the solver outputs
+     *
+     * Realtime-safe if the outputs are already sized to the number of joints.
+     *
+     * @param order The polynomial order in [0, \ref MAX_ORDER]
+     * @param time Time since the last solver output in solver cycles
+     * @param positions The extrapolated joint positions on return
+     * @param velocities The extrapolated joint velocities on return
+     */
+    void extrapolate(int order,
+                     double time,
+                     std::vector<double>& positions,
+                     std::vector<double>& velocities) const;
+
+  private:
+    /**
+     * @brief Extrapolate one quantity of all joints
+     *
+     * @param history Solver outputs, newest first
+     */
+    static void extrapolate(const std::array<std::vector<double>, MAX_ORDER + 1>& history,
+                            int order,
+                            double time,
+                            std::vector<double>& out);
+
+    // Solver outputs, newest first
+    std::array<std::vector<double>, MAX_ORDER + 1> m_positions;
+    std::array<std::vector<double>, MAX_ORDER + 1> m_velocities;
+
+    KDL::JntArray m_upper_pos_limits;
+    KDL::JntArray m_lower_pos_limits;
+};
+
+} // namespace core
+} // namespace cartesian_controller_base
+
+#endif
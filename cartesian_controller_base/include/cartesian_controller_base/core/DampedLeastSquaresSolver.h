@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    DampedLeastSquaresSolver.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2020/03/27
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef CORE_DAMPED_LEAST_SQUARES_SOLVER_H_INCLUDED
+#define CORE_DAMPED_LEAST_SQUARES_SOLVER_H_INCLUDED
+
+#include <cartesian_controller_base/JointCountDispatch.h>
+#include <cartesian_controller_base/core/IKSolver.h>
+#include <Eigen/Dense>
+#include <kdl/jacobian.hpp>
+
+namespace cartesian_controller_base{
+namespace core{
+
+  /**
+   * \brief A damped least squares IK solver for Cartesian controllers
+   *
+   *
+   *  The resulting joint velocities are computed according to
+   *  \f$ \dot{q} = ( J^T J + \alpha^2 I )^{-1} J^T f \f$
+   *  Where \f$ J \f$ denotes the manipulator's joint Jacobian and \f$ f \f$ is
+   *  the applied force to the end effector.
+   *  \f$ \alpha \f$ is a damping term.
+   *  For controlling end effector motion, e.g. in the
+   *  \ref cartesian_motion_controller::CartesianMotionController \f$ f \f$ should be
+   *  thought of as an error direction vector that is mapped to wrench space
+   *  with a unit stiffness.
+   *
+   *  The damped least squares formulation is according to Wampler
+   *  https://ieeexplore.ieee.org/abstract/document/4075580  
+   *
+   *  For six or more joints, the solver uses the equivalent formulation
+   *  \f$ \dot{q} = J^T ( J J^T + \alpha^2 I )^{-1} f \f$
+   *  which only requires the decomposition of a 6x6 matrix.
+   */
+class DampedLeastSquaresSolver : public IKSolver
+{
+  public:
+    //! Configuration
+    struct Parameters
+    {
+      double alpha = 1.0; ///< damping coefficient, > 0
+    };
+
+    DampedLeastSquaresSolver();
+    ~DampedLeastSquaresSolver();
+
+    /**
+     * \brief Compute joint target commands with damped least squares
+     *
+     * \param period The duration in sec for this simulation step
+     * \param net_force The applied net force, expressed in the root frame
+     */
+    void computeJointControlCmds(double period, const ctrl::Vector6D& net_force) override;
+
+    bool init(const KDL::Chain& chain,
+              const KDL::JntArray& upper_pos_limits,
+              const KDL::JntArray& lower_pos_limits) override;
+
+    //! Set the configuration. Realtime-safe.
+    void setParameters(const Parameters& parameters) { m_parameters = parameters; }
+
+    const Parameters& getParameters() const { return m_parameters; }
+
+  private:
+    /**
+     * \brief Compute joint velocities with damped least squares
+     *
+     * \tparam Dof The number of joints or Eigen::Dynamic, see \ref dispatchJointCount
+     * \param net_force The applied net force, expressed in the root frame
+     * \param alpha The damping coefficient
+     */
+    template <int Dof>
+    void computeJointVelocities(const ctrl::Vector6D& net_force, double alpha);
+
+    //! The implementation for this chain's number of joints
+    void (DampedLeastSquaresSolver::*m_compute_joint_velocities)(const ctrl::Vector6D&, double) = nullptr;
+
+    // Workspace for the damped least squares solution.
+    // Only the smaller of both sides is used, depending on the number of joints.
+    ctrl::Matrix6D              m_task_space_matrix;
+    Eigen::LLT<ctrl::Matrix6D>  m_task_space_decomposition;
+    ctrl::Vector6D              m_task_space_force;
+    ctrl::MatrixND              m_jnt_space_matrix;
+    Eigen::LLT<ctrl::MatrixND>  m_jnt_space_decomposition;
+
+    Parameters m_parameters;
+};
+
+} // namespace core
+} // namespace cartesian_controller_base
+
+#endif
@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    ForwardDynamicsSolver.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2016/02/14
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef CORE_FORWARD_DYNAMICS_SOLVER_H_INCLUDED
+#define CORE_FORWARD_DYNAMICS_SOLVER_H_INCLUDED
+
+#include <cartesian_controller_base/JointCountDispatch.h>
+#include <cartesian_controller_base/Utility.h>
+#include <cartesian_controller_base/core/IKSolver.h>
+#include <Eigen/Dense>
+#include <kdl/chain.hpp>
+#include <kdl/chaindynparam.hpp>
+#include <kdl/jntspaceinertiamatrix.hpp>
+#include <memory>
+#include <vector>
+
+namespace cartesian_controller_base{
+namespace core{
+
+/*! \brief The default IK solver for Cartesian controllers
+ *
+ *  This class computes manipulator joint motion from Cartesian force inputs.
+ *  As inputs, both forces and torques are applied to the mechanical system,
+ *  representing the manipulator. The system is modeled as a chain of rigid
+ *  bodies. All bodies except for the last one are massless. This is to
+ *  achieve a nearly linear behavior in all joint configurations.
+ *  The resulting joint accelerations are computed according to
+ *  \f$ \ddot{q} = H^{-1} ( J^T f) \f$
+ *  Where \f$ H \f$ denotes the joint space inertia matrix of the virtually
+ *  conditioned system, \f$ J \f$ denotes the joint Jacobian and \f$ f \f$ is
+ *  the applied force to the end effector.  The joint accelerations are
+ *  integrated twice to obtain joint velocities and joint positions
+ *  respectively.
+ *  Check more details behind the solver here: https://arxiv.org/pdf/1908.06252.pdf
+ */
+class ForwardDynamicsSolver : public IKSolver
+{
+  public:
+    //! Configuration
+    struct Parameters
+    {
+      /**
+       * Virtual link mass
+       * Virtual mass of the manipulator's links. The smaller this value, the
+       * more does the end-effector (which has a unit mass of 1.0) dominate dynamic
+       * behavior. Near singularities, a bigger value leads to smoother motion.
+       * Must be > 0.
+       */
+      double link_mass = 0.1;
+    };
+
+    ForwardDynamicsSolver();
+    ~ForwardDynamicsSolver();
+
+    /**
+     * @brief Compute joint target commands with approximate forward dynamics
+     *
+     * The resulting motion is the output of a forward dynamics simulation. It
+     * can be forwarded to a real controller to mimic the simulated behavior.
+     *
+     * @param period The duration in sec for this simulation step
+     * @param net_force The applied net force, expressed in the root frame
+     */
+    void computeJointControlCmds(double period, const ctrl::Vector6D& net_force) override;
+
+    bool init(const KDL::Chain& chain,
+              const KDL::JntArray& upper_pos_limits,
+              const KDL::JntArray& lower_pos_limits) override;
+
+    /**
+     * @brief Set the configuration
+     *
+     * Realtime-safe.  A new link mass takes effect in the next step.
+     */
+    void setParameters(const Parameters& parameters) { m_parameters = parameters; }
+
+    const Parameters& getParameters() const { return m_parameters; }
+
+    /**
+     * @brief Number of times the generic model has been built
+     *
+     * This includes the initial build in init().  Each new link mass
+     * triggers a rebuild in the next step.
+     */
+    unsigned int getModelBuildCount() const { return m_model_build_count; }
+
+  private:
+
+    /**
+     * @brief Build a generic robot model for control
+     *
+     * This only sets the inertias of the segments in \ref m_model_chain and
+     * is realtime-safe.  The dynamics solver reads them on each call.
+     * Inertias of merged fixed segments are combined exactly.
+     *
+     * @param link_mass The virtual mass of each moving link
+     *
+     * @return True, if everything went well
+     */
+    bool buildGenericModel(double link_mass);
+
+    /**
+     * @brief Compute joint accelerations with the generic model's inertia
+     *
+     * @tparam Dof The number of joints or Eigen::Dynamic, see \ref dispatchJointCount
+     * @param net_force The applied net force, expressed in the root frame
+     */
+    template <int Dof>
+    void computeJointAccelerations(const ctrl::Vector6D& net_force);
+
+    //! The implementation for this chain's number of joints
+    void (ForwardDynamicsSolver::*m_compute_joint_accelerations)(const ctrl::Vector6D&) = nullptr;
+
+    // Forward dynamics
+    KDL::Chain                                  m_model_chain; ///< m_chain with merged fixed segments
+    std::vector<CollapsedSegment>               m_model_segments; ///< where m_chain's segments are in the model
+    std::shared_ptr<KDL::ChainDynParam>       m_jnt_space_inertia_solver;
+    KDL::JntSpaceInertiaMatrix                  m_jnt_space_inertia;
+    Eigen::LDLT<ctrl::MatrixND>                 m_jnt_space_inertia_decomposition;
+    double                                      m_model_link_mass = {0.0}; ///< link mass of the current generic model
+    unsigned int                                m_model_build_count = {0};
+
+    Parameters m_parameters;
+};
+
+} // namespace core
+} // namespace cartesian_controller_base
+
+#endif
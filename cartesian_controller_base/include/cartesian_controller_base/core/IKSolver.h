@@ -0,0 +1,220 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    IKSolver.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2016/02/14
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef CORE_IKSOLVER_H_INCLUDED
+#define CORE_IKSOLVER_H_INCLUDED
+
+#include <cartesian_controller_base/KinematicsCache.h>
+#include <cartesian_controller_base/Utility.h>
+#include <kdl/chain.hpp>
+#include <kdl/frames.hpp>
+#include <kdl/jntarray.hpp>
+
+namespace cartesian_controller_base{
+namespace core{
+
+/*! \brief Base class to compute manipulator joint motion from Cartesian force inputs.
+ *
+ *  This is the ROS-independent part of the IK solvers.  Child classes
+ *  implement different inverse kinematics algorithms and take their
+ *  configuration as plain structs.  The solver plugins of the controllers,
+ *  see \ref cartesian_controller_base::IKSolver, are thin adapters around
+ *  them.
+ */
+class IKSolver
+{
+  public:
+    IKSolver();
+    virtual ~IKSolver();
+
+    /**
+     * @brief Initialize the solver
+     *
+     * Not realtime-safe.
+     *
+     * @param chain The kinematic chain of the robot
+     * @param upper_pos_limits Tuple with max positive joint angles
+     * @param lower_pos_limits Tuple with max negative joint angles
+     *
+     * @return True, if everything went well
+     */
+    virtual bool init(const KDL::Chain& chain,
+                      const KDL::JntArray& upper_pos_limits,
+                      const KDL::JntArray& lower_pos_limits);
+
+    /**
+     * @brief Simulate one step with the specific IK algorithm
+     *
+     * The resulting joint positions and velocities are available with \ref
+     * getPositions() and \ref getVelocities().  Implementations must not
+     * allocate memory.
+     *
+     * @param period The duration in sec for this simulation step
+     * @param net_force The applied net force, expressed in the root frame
+     */
+    virtual void computeJointControlCmds(double period, const ctrl::Vector6D& net_force) = 0;
+
+    /**
+     * @brief Get the current end effector pose of the simulated robot
+     *
+     * The last link in the chain from the init() function is taken as end
+     * effector, unless \ref setToolFrame() sets a different one. If \ref setStartState() has been called immediately before,
+     * then the returned pose represents the real robots end effector pose.
+     *
+     * @return The end effector pose with respect to the robot base link. This
+     * link is the same as the one implicitly given in the init() function.
+     */
+    const KDL::Frame& getEndEffectorPose() const { return m_end_effector_pose; }
+
+    /**
+     * @brief Get the current end effector velocity of the simulated robot
+     *
+     * @return The end effector vel with respect to the robot base link. The
+     * order is first translation, then rotation.
+     */
+    const ctrl::Vector6D& getEndEffectorVel() const { return m_end_effector_vel; }
+
+    //! The current joint positions of the simulated robot
+    const KDL::JntArray& getPositions() const { return m_current_positions; }
+
+    //! The current joint velocities of the simulated robot
+    const KDL::JntArray& getVelocities() const { return m_current_velocities; }
+
+    //! The number of joints
+    int getNumberJoints() const { return m_number_joints; }
+
+    /**
+     * @brief Get the poses of all links of the simulated robot
+     *
+     * The poses are recomputed only if the joint positions have changed since
+     * the last call, e.g. through \ref synchronizeJointPositions().  Use this
+     * for all frame transformations within a control cycle.
+     *
+     * @return The forward kinematics for the current joint positions
+     */
+    const KinematicsCache& getKinematics();
+
+    /**
+     * @brief Set initial joint configuration
+     *
+     * Resets the joint velocities and accelerations.
+     *
+     * @param positions The real robot's joint positions
+     */
+    void setStartState(const KDL::JntArray& positions);
+
+    /**
+     * @brief Set initial joint configuration of a moving robot
+     *
+     * Resets the joint accelerations.
+     *
+     * @param positions The real robot's joint positions
+     * @param velocities The real robot's joint velocities
+     */
+    void setStartState(const KDL::JntArray& positions, const KDL::JntArray& velocities);
+
+    /**
+     * @brief Synchronize joint positions with the real robot
+     *
+     * Call this periodically in the control loop.  The internal model's joint
+     * velocity is not sychronized. This makes the solver more stable. Derived
+     * IK solvers should implement how to keep or reset those values.
+     *
+     * @param positions The real robot's joint positions
+     */
+    void synchronizeJointPositions(const KDL::JntArray& positions);
+
+    /**
+     * @brief Set the tool center point that the solver controls
+     *
+     * The default is the last link in the chain from the init() function.
+     * This only replaces the final fixed transform of the kinematics and is
+     * realtime-safe.  Call \ref updateKinematics() afterwards.
+     *
+     * @param link The index of the TCP's parent link, see KinematicsCache::linkIndex()
+     * @param offset The TCP's pose in that link
+     */
+    void setToolFrame(int link, const KDL::Frame& offset);
+
+    /**
+     * @brief Update the robot kinematics of the solver
+     *
+     * Call this periodically to update the internal simulation's forward
+     * kinematics.
+     */
+    void updateKinematics();
+
+  protected:
+
+    /**
+     * @brief Make sure positions stay in allowed margins
+     *
+     * Limit internal joint buffers to the position limits provided by URDF.
+     * A joint will be treated as continuous, if the continuous type is set for this joint.
+     * If both upper and lower limits are zero, the joint appears fixed.  Note
+     * that this is the default urdf initializer if limits are omitted.
+     */
+    void applyJointLimits();
+
+    //! The underlying physical system
+    KDL::Chain m_chain;
+
+    //! Number of controllable joint
+    int m_number_joints = {0};
+
+    // Internal buffers
+    KDL::JntArray m_current_positions;
+    KDL::JntArray m_current_velocities;
+    KDL::JntArray m_current_accelerations;
+    KDL::JntArray m_last_positions;
+    KDL::JntArray m_last_velocities;
+
+    // Joint limits
+    KDL::JntArray m_upper_pos_limits;
+    KDL::JntArray m_lower_pos_limits;
+
+    // Forward kinematics
+    KinematicsCache m_kinematics;
+    KDL::Frame      m_end_effector_pose;
+    ctrl::Vector6D  m_end_effector_vel;
+};
+
+} // namespace core
+} // namespace cartesian_controller_base
+
+#endif
@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    PDController.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2019/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef CORE_PD_CONTROLLER_H_INCLUDED
+#define CORE_PD_CONTROLLER_H_INCLUDED
+
+#include <cartesian_controller_base/Utility.h>
+#include <array>
+
+namespace cartesian_controller_base
+{
+namespace core
+{
+
+/**
+ * @brief A proportional, derivative controller
+ *
+ * The ROS-independent part of \ref cartesian_controller_base::PDController.
+ */
+class PDController
+{
+  public:
+    PDController();
+    ~PDController();
+
+    //! Gain parameters
+    struct Gains
+    {
+      double p = 0.0; ///< proportional gain
+      double d = 0.0; ///< derivative gain
+    };
+
+    //! Set the gains. Realtime-safe.
+    void setGains(const Gains& gains) { m_gains = gains; }
+
+    const Gains& getGains() const { return m_gains; }
+
+    /**
+     * @brief Call operator for one control cycle
+     *
+     * @param error The control error to reduce. Target - current.
+     * @param period The period for this control step in sec.
+     *
+     * @return The control output. Zero for a zero period.
+     */
+    double operator()(double error, double period);
+
+  private:
+    Gains m_gains;
+    double m_last_p_error;
+
+};
+
+/**
+ * @brief A 6-dimensional PD controller class
+ *
+ * Separate PD controllers for each of the Cartesian axes, i.e. three
+ * translational controllers and three rotational controllers.
+ */
+class SpatialPDController
+{
+  public:
+    SpatialPDController();
+
+    //! Set the gains of each axis (translational, rotational). Realtime-safe.
+    void setGains(const std::array<PDController::Gains, 6>& gains);
+
+    /**
+     * @brief Call operator for one control cycle
+     *
+     * @param error The control error to reduce. Target - current.
+     * @param period The period for this control step in sec.
+     *
+     * @return The controlled 6-dim vector (translational, rotational).
+     */
+    ctrl::Vector6D operator()(const ctrl::Vector6D& error, double period);
+
+  private:
+    ctrl::Vector6D m_cmd;
+    std::array<PDController, 6> m_pd_controllers;
+
+};
+
+} // namespace core
+} // namespace cartesian_controller_base
+
+#endif
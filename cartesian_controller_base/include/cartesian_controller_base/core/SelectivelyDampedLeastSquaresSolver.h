@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    SelectivelyDampedLeastSquaresSolver.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2020/06/21
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef CORE_SELECTIVELY_DAMPED_LEAST_SQUARES_SOLVER_H_INCLUDED
+#define CORE_SELECTIVELY_DAMPED_LEAST_SQUARES_SOLVER_H_INCLUDED
+
+#include <cartesian_controller_base/JointCountDispatch.h>
+#include <cartesian_controller_base/core/IKSolver.h>
+#include <Eigen/Dense>
+#include <kdl/jacobian.hpp>
+
+namespace cartesian_controller_base{
+namespace core{
+
+  /**
+   * \brief A selectively damped least squares (SDLS) IK solver for Cartesian controllers
+   *
+   *  This implements the SDLS method by Buss and Kim from 2005.
+   *
+   *  The implementation is according to their paper:
+   *  https://www.tandfonline.com/doi/abs/10.1080/2151237X.2005.10129202
+   *
+   *  which is available here:
+   *  https://www.researchgate.net/profile/Samuel_Buss/publication/220494116_Selectively_Damped_Least_Squares_for_Inverse_Kinematics/links/09e4150cc04794d9d0000000/Selectively-Damped-Least-Squares-for-Inverse-Kinematics.pdf
+   *
+   *  It has the advantage over the DLS method in that it converges faster and
+   *  does not require ad-hoc damping terms, i.e. users do not need to specify
+   *  task dependent damping values, which can otherwise require numerous
+   *  trials and expertise.  It is, however, more computationally evolved.
+   *
+   *  Instead of a full singular value decomposition of the 6xN Jacobian
+   *  \f$ J \f$, we use the eigendecomposition of the 6x6 matrix \f$ J J^T \f$.
+   *  Its eigenvalues are the squared singular values and its eigenvectors are
+   *  the left singular vectors \f$ u_i \f$.  The right singular vectors follow
+   *  from \f$ v_i = J^T u_i / \sigma_i \f$.
+   *
+   */
+class SelectivelyDampedLeastSquaresSolver : public IKSolver
+{
+  public:
+    SelectivelyDampedLeastSquaresSolver();
+    ~SelectivelyDampedLeastSquaresSolver();
+
+    /**
+     * \brief Compute joint target commands with selectively damped least squares
+     *
+     * \param period The duration in sec for this simulation step
+     * \param net_force The applied net force, expressed in the root frame
+     */
+    void computeJointControlCmds(double period, const ctrl::Vector6D& net_force) override;
+
+    bool init(const KDL::Chain& chain,
+              const KDL::JntArray& upper_pos_limits,
+              const KDL::JntArray& lower_pos_limits) override;
+
+  private:
+    /**
+     * @brief Helper function to clamp a column vector in-place
+     *
+     * This literally implements ClampMaxAbs() from Buss' and Kim's paper.
+     *
+     * @param w The vector to clamp
+     * @param d The threshold for the max allowed value
+     */
+    template <class Derived>
+    static void clampMaxAbs(Eigen::MatrixBase<Derived>& w, double d)
+    {
+      const double max = w.cwiseAbs().maxCoeff();
+      if (max > d)
+      {
+        w *= d / max;
+      }
+    }
+
+    /**
+     * @brief Compute joint velocities with the SDLS method
+     *
+     * @tparam Dof The number of joints or Eigen::Dynamic, see \ref dispatchJointCount
+     * @param net_force The applied net force, expressed in the root frame
+     */
+    template <int Dof>
+    void computeJointVelocities(const ctrl::Vector6D& net_force);
+
+    //! The implementation for this chain's number of joints
+    void (SelectivelyDampedLeastSquaresSolver::*m_compute_joint_velocities)(const ctrl::Vector6D&) = nullptr;
+
+    // Workspace
+    ctrl::Matrix6D                                  m_jjt;
+    Eigen::SelfAdjointEigenSolver<ctrl::Matrix6D>   m_jjt_decomposition;
+    ctrl::VectorND                                  m_rho;  ///< translational norm of each Jacobian column
+    ctrl::VectorND                                  m_phi;
+
+};
+
+} // namespace core
+} // namespace cartesian_controller_base
+
+#endif
@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    TargetPredictor.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef CORE_TARGET_PREDICTOR_H_INCLUDED
+#define CORE_TARGET_PREDICTOR_H_INCLUDED
+
+#include <Eigen/Geometry>
+#include <cstdint>
+#include <kdl/frames.hpp>
+#include <vector>
+
+namespace cartesian_controller_base
+{
+namespace core
+{
+
+/**
+ * @brief Latency compensation for timestamped target poses
+ *
+ * Targets from perception or teleoperation often arrive late and with
+ * jitter.  This class keeps a short history of the targets by their time of
+ * creation and estimates the target's velocity with a least-squares line
+ * fit over that history.  The control loop then extrapolates the latest
+ * target with constant velocity to its own time with \ref extrapolate().
+ *
+ * Samples that are not newer than the latest one are rejected.  Samples
+ * that are older than a maximal age relative to the newest one don't count
+ * for the velocity, e.g. those from before a pause in the stream.
+ */
+class TargetPredictor
+{
+  public:
+    //! The latest target and its estimated velocity
+    struct Prediction
+    {
+      int64_t stamp = 0; ///< nanoseconds
+      KDL::Frame pose;
+      KDL::Vector linear_velocity = KDL::Vector::Zero();
+      KDL::Vector angular_velocity = KDL::Vector::Zero();  ///< Rotation vector per second
+    };
+
+    TargetPredictor();
+
+    /**
+     * @brief Allocate the history
+     *
+     * Not realtime-safe.
+     *
+     * @param history The number of samples for the velocity estimation, at least 2
+     * @param max_age The maximal age in seconds of samples relative to the newest
+     * one for the velocity estimation.  Zero disables the limit.
+     */
+    void init(size_t history, double max_age = 0.0);
+
+    /**
+     * @brief Forget all samples
+     */
+    void reset();
+
+    /**
+     * @brief Add a new sample and update the prediction
+     *
+     * @param stamp When the target was created in nanoseconds
+     * @param pose The target pose
+     *
+     * @return False if the sample is not newer than the latest one
+     */
+    bool add(int64_t stamp, const KDL::Frame& pose);
+
+    //! The prediction after the last successful \ref add()
+    const Prediction& prediction() const { return m_prediction; }
+
+    /**
+     * @brief Extrapolate a prediction with constant velocity
+     *
+     * Realtime-safe.
+     *
+     * @param prediction The latest target and its velocity
+     * @param time The time to extrapolate to in nanoseconds
+     * @param max_horizon The maximal extrapolation in seconds.  Zero disables extrapolation.
+     *
+     * @return The target pose at the given time
+     */
+    static KDL::Frame extrapolate(const Prediction& prediction, int64_t time, double max_horizon);
+
+  private:
+    struct Sample
+    {
+      int64_t stamp;
+      Eigen::Vector3d position;
+      Eigen::Quaterniond orientation;
+    };
+
+    std::vector<Sample> m_samples;  ///< Ring buffer
+    size_t m_newest = {0};
+    size_t m_count = {0};
+    int64_t m_max_age = {0};  ///< nanoseconds
+    Prediction m_prediction;
+};
+
+} // namespace core
+} // namespace cartesian_controller_base
+
+#endif
@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    ArticulatedBodySolver.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <cartesian_controller_base/ArticulatedBodySolver.h>
+#include <pluginlib/class_list_macros.hpp>
+
+/**
+ * \class cartesian_controller_base::ArticulatedBodySolver
+ *
+ * Users may explicitly specify this solver with \a "articulated_body" as \a
+ * ik_solver in their controllers.yaml configuration file for each controller:
+ *
+ * \code{.yaml}
+ * <name_of_your_controller>:
+ *   ros__parameters:
+ *     ik_solver: "articulated_body"
+ *     ...
+ *
+ *     solver:
+ *         ...
+ *         articulated_body:
+ *             link_mass: 0.5
+ * \endcode
+ *
+ */
+PLUGINLIB_EXPORT_CLASS(cartesian_controller_base::ArticulatedBodySolver, cartesian_controller_base::IKSolver)
+
+
+namespace cartesian_controller_base{
+
+  ArticulatedBodySolver::ArticulatedBodySolver()
+    : IKSolver(m_solver)
+  {
+  }
+
+  ArticulatedBodySolver::~ArticulatedBodySolver(){}
+
+  void ArticulatedBodySolver::getJointControlCmds(
+        rclcpp::Duration period,
+        const ctrl::Vector6D& net_force,
+        trajectory_msgs::msg::JointTrajectoryPoint& control_cmd)
+  {
+    // Pick up parameter changes from the node
+    m_solver.setParameters(m_parameters.get());
+
+    IKSolver::getJointControlCmds(period, net_force, control_cmd);
+  }
+
+#if defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
+  bool ArticulatedBodySolver::init(std::shared_ptr<rclcpp_lifecycle::LifecycleNode> nh,
+#else
+  bool ArticulatedBodySolver::init(std::shared_ptr<rclcpp::Node> nh,
+#endif
+                                   const KDL::Chain& chain,
+                                   const KDL::JntArray& upper_pos_limits,
+                                   const KDL::JntArray& lower_pos_limits)
+  {
+    // Set the initial value if provided at runtime, else use default value.
+    if (!nh->has_parameter(m_params + "/link_mass"))
+    {
+      nh->declare_parameter<double>(m_params + "/link_mass", 0.1);
+    }
+    if (!m_parameters.init(
+          nh,
+          {m_params + "/link_mass"},
+          [this](const rclcpp::Parameter& parameter, core::ArticulatedBodySolver::Parameters& params, std::string& reason) {
+            if (parameter.get_name() == m_params + "/link_mass")
+            {
+              double link_mass = 0.0;
+              if (!parameters::assign(parameter, link_mass, reason) || link_mass <= 0.0)
+              {
+                reason = parameter.get_name() + " must be finite and > 0";
+                return false;
+              }
+              params.link_mass = link_mass;
+            }
+            return true;
+          }))
+    {
+      return false;
+    }
+
+    m_solver.setParameters(m_parameters.getNonRT());
+    if (!IKSolver::init(nh, chain, upper_pos_limits, lower_pos_limits))
+    {
+      RCLCPP_ERROR(nh->get_logger(), "Articulated body solver needs at least one joint");
+      return false;
+    }
+
+    RCLCPP_INFO(nh->get_logger(), "Articulated body solver initialized");
+    RCLCPP_INFO(nh->get_logger(), "Articulated body solver has control over %i joints", m_solver.getNumberJoints());
+
+    return true;
+  }
+
+} // namespace
@@ -68,52 +68,21 @@ PLUGINLIB_EXPORT_CLASS(cartesian_controller_base::DampedLeastSquaresSolver, cart
 namespace cartesian_controller_base{
 
   DampedLeastSquaresSolver::DampedLeastSquaresSolver()
-    : m_alpha(0.01)
+    : IKSolver(m_solver)
   {
   }
 
   DampedLeastSquaresSolver::~DampedLeastSquaresSolver(){}
 
-  trajectory_msgs::msg::JointTrajectoryPoint DampedLeastSquaresSolver::getJointControlCmds(
+  void DampedLeastSquaresSolver::getJointControlCmds(
         rclcpp::Duration period,
-        const ctrl::Vector6D& net_force)
+        const ctrl::Vector6D& net_force,
+        trajectory_msgs::msg::JointTrajectoryPoint& control_cmd)
   {
-    // Compute joint jacobian
-    m_jnt_jacobian_solver->JntToJac(m_current_positions,m_jnt_jacobian);
+    // Pick up parameter changes from the node
+    m_solver.setParameters(m_parameters.get());
 
-    // Compute joint velocities according to:
-    // \f$ \dot{q} = ( J^T J + \alpha^2 I )^{-1} J^T f \f$
-    ctrl::MatrixND identity;
-    identity.setIdentity(m_number_joints, m_number_joints);
-    m_handle->get_parameter(m_params + "/alpha", m_alpha);
-
-    m_current_velocities.data =
-      (m_jnt_jacobian.data.transpose() * m_jnt_jacobian.data
-       + m_alpha * m_alpha * identity).inverse() * m_jnt_jacobian.data.transpose() * net_force;
-
-    // Integrate once, starting with zero motion
-    m_current_positions.data = m_last_positions.data + 0.5 * m_current_velocities.data * period.seconds();
-
-    // Make sure positions stay in allowed margins
-    applyJointLimits();
-
-    // Apply results
-    trajectory_msgs::msg::JointTrajectoryPoint control_cmd;
-    for (int i = 0; i < m_number_joints; ++i)
-    {
-      control_cmd.positions.push_back(m_current_positions(i));
-      control_cmd.velocities.push_back(m_current_velocities(i));
-
-      // Accelerations should be left empty. Those values will be interpreted
-      // by most hardware joint drivers as max. tolerated values. As a
-      // consequence, the robot will move very slowly.
-    }
-    control_cmd.time_from_start = period; // valid for this duration
-
-    // Update for the next cycle
-    m_last_positions = m_current_positions;
-
-    return control_cmd;
+    IKSolver::getJointControlCmds(period, net_force, control_cmd);
   }
 
 #if defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
@@ -125,14 +94,33 @@ namespace cartesian_controller_base{
                                       const KDL::JntArray& upper_pos_limits,
                                       const KDL::JntArray& lower_pos_limits)
   {
-    IKSolver::init(nh, chain, upper_pos_limits, lower_pos_limits);
-
-    m_jnt_jacobian_solver.reset(new KDL::ChainJntToJacSolver(m_chain));
-    m_jnt_jacobian.resize(m_number_joints);
+    if (!nh->has_parameter(m_params + "/alpha"))
+    {
+      nh->declare_parameter<double>(m_params + "/alpha", 1.0);
+    }
 
-    nh->declare_parameter<double>(m_params + "/alpha", 1.0);
+    if (!m_parameters.init(
+      nh,
+      {m_params + "/alpha"},
+      [this](const rclcpp::Parameter& parameter, core::DampedLeastSquaresSolver::Parameters& params, std::string& reason) {
+        if (parameter.get_name() == m_params + "/alpha")
+        {
+          double alpha = 0.0;
+          if (!parameters::assign(parameter, alpha, reason) || alpha <= 0.0)
+          {
+            reason = parameter.get_name() + " must be finite and > 0";
+            return false;
+          }
+          params.alpha = alpha;
+        }
+        return true;
+      }))
+    {
+      return false;
+    }
 
-    return true;
+    m_solver.setParameters(m_parameters.getNonRT());
+    return IKSolver::init(nh, chain, upper_pos_limits, lower_pos_limits);
   }
 
 
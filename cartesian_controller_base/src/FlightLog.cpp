@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    FlightLog.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cartesian_controller_base/FlightLog.h>
+#include <cstring>
+#include <fstream>
+
+namespace cartesian_controller_base
+{
+
+FlightLog::FlightLog()
+{
+  std::memset(&m_header, 0, sizeof(m_header));
+}
+
+bool FlightLog::open(const std::string& file, std::string& error)
+{
+  m_size = 0;
+  m_records.clear();
+
+  std::ifstream in(file, std::ios::binary);
+  if (!in)
+  {
+    error = "Failed to open " + file;
+    return false;
+  }
+
+  if (!in.read(reinterpret_cast<char*>(&m_header), sizeof(m_header)) ||
+      std::memcmp(m_header.magic, "CCFLIGHT", sizeof(m_header.magic)) != 0)
+  {
+    error = file + " is not a flight recording";
+    return false;
+  }
+  if (m_header.version != FlightRecorder::VERSION)
+  {
+    error = "Unsupported flight recording version " + std::to_string(m_header.version);
+    return false;
+  }
+
+  m_record_words = FlightRecorder::layout(
+    m_header.number_joints, m_header.number_stages, m_field_offsets, m_field_sizes);
+  if (m_header.record_size != m_record_words * sizeof(double))
+  {
+    error = "Unexpected record size " + std::to_string(m_header.record_size);
+    return false;
+  }
+
+  m_records.resize(m_header.capacity * m_record_words);
+  if (!in.read(reinterpret_cast<char*>(m_records.data()), m_records.size() * sizeof(double)))
+  {
+    error = file + " is truncated";
+    return false;
+  }
+
+  // The file is a ring of the most recent records
+  m_size = std::min(m_header.records_written, m_header.capacity);
+  m_first = m_header.records_written > m_header.capacity ?
+    m_header.records_written % m_header.capacity : 0;
+  return true;
+}
+
+uint64_t FlightLog::sequence(size_t record) const
+{
+  uint64_t sequence;
+  std::memcpy(&sequence, data(record), sizeof(sequence));
+  return sequence;
+}
+
+int64_t FlightLog::stamp(size_t record) const
+{
+  int64_t stamp;
+  std::memcpy(&stamp, data(record) + 1, sizeof(stamp));
+  return stamp;
+}
+
+const double* FlightLog::data(size_t record) const
+{
+  return m_records.data() + ((m_first + record) % m_header.capacity) * m_record_words;
+}
+
+}
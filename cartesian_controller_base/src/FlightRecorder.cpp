@@ -0,0 +1,285 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    FlightRecorder.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <cartesian_controller_base/FlightRecorder.h>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <rclcpp/logging.hpp>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace cartesian_controller_base
+{
+
+namespace
+{
+  //! Samples that the ring buffer can hold before the drain thread catches up
+  constexpr size_t RING_SLOTS = 1024;
+
+  //! How often the drain thread wakes up
+  constexpr std::chrono::milliseconds DRAIN_PERIOD(10);
+
+  //! Words of the sequence number and time stamp at the start of each record
+  constexpr size_t RECORD_HEADER_WORDS = 2;
+}
+
+FlightRecorder::FlightRecorder()
+{
+}
+
+FlightRecorder::~FlightRecorder()
+{
+  stop();
+}
+
+bool FlightRecorder::init(const std::string& file,
+                          int number_joints,
+                          int number_stages,
+                          size_t capacity,
+                          const rclcpp::Logger& logger)
+{
+  stop();
+
+  if (capacity == 0)
+  {
+    RCLCPP_ERROR(logger, "Flight recorder needs a capacity > 0");
+    return false;
+  }
+
+  m_record_words = layout(number_joints, number_stages, m_field_offsets, m_field_sizes);
+  const size_t record_size = m_record_words * sizeof(double);
+
+  m_sample.assign(m_record_words, 0.0);
+  m_ring.assign(RING_SLOTS * m_record_words, 0.0);
+  m_slots = RING_SLOTS;
+  m_head = 0;
+  m_tail = 0;
+  m_dropped = 0;
+  m_sequence = 0;
+
+  // Map the file
+  m_map_size = sizeof(FileHeader) + capacity * record_size;
+  m_fd = ::open(file.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (m_fd < 0)
+  {
+    RCLCPP_ERROR(logger, "Failed to open flight recorder file %s: %s", file.c_str(), std::strerror(errno));
+    return false;
+  }
+  if (::ftruncate(m_fd, m_map_size) != 0)
+  {
+    RCLCPP_ERROR(logger, "Failed to resize flight recorder file %s: %s", file.c_str(), std::strerror(errno));
+    stop();
+    return false;
+  }
+  m_map = ::mmap(nullptr, m_map_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+  if (m_map == MAP_FAILED)
+  {
+    RCLCPP_ERROR(logger, "Failed to map flight recorder file %s: %s", file.c_str(), std::strerror(errno));
+    m_map = nullptr;
+    stop();
+    return false;
+  }
+
+  m_header = static_cast<FileHeader*>(m_map);
+  m_records = static_cast<char*>(m_map) + sizeof(FileHeader);
+  std::memcpy(m_header->magic, "CCFLIGHT", sizeof(m_header->magic));
+  m_header->version         = VERSION;
+  m_header->number_joints   = number_joints;
+  m_header->number_stages   = number_stages;
+  m_header->record_size     = record_size;
+  m_header->capacity        = capacity;
+  m_header->records_written = 0;
+  m_header->samples_dropped = 0;
+
+  m_stop = false;
+  m_thread = std::thread(&FlightRecorder::run, this);
+  m_enabled = true;
+
+  RCLCPP_INFO(logger, "Recording controller internals to %s", file.c_str());
+  return true;
+}
+
+size_t FlightRecorder::layout(int number_joints,
+                              int number_stages,
+                              std::array<size_t, NUM_FIELDS>& offsets,
+                              std::array<size_t, NUM_FIELDS>& sizes)
+{
+  sizes[JOINT_POSITIONS]      = number_joints;
+  sizes[TARGET_FRAME]         = 7;
+  sizes[TARGET_WRENCH]        = 6;
+  sizes[SENSOR_WRENCH]        = 6;
+  sizes[CARTESIAN_INPUT]      = 6;
+  sizes[SIMULATED_POSITIONS]  = number_joints;
+  sizes[SIMULATED_VELOCITIES] = number_joints;
+  sizes[STAGE_LATENCIES]      = number_stages;
+  sizes[ITERATIONS]           = 1;
+  sizes[EVENTS]               = 1;
+  sizes[START_VELOCITIES]     = number_joints;
+  sizes[TOOL_LINK]            = 1;
+  sizes[TOOL_FRAME]           = 7;
+
+  size_t words = RECORD_HEADER_WORDS;
+  for (int i = 0; i < NUM_FIELDS; ++i)
+  {
+    offsets[i] = words;
+    words += sizes[i];
+  }
+  return words;
+}
+
+void FlightRecorder::set(Field field, const KDL::Frame& frame)
+{
+  if (m_enabled)
+  {
+    double* data = this->field(field);
+    data[0] = frame.p.x();
+    data[1] = frame.p.y();
+    data[2] = frame.p.z();
+    frame.M.GetQuaternion(data[3], data[4], data[5], data[6]);
+  }
+}
+
+void FlightRecorder::event(Event event)
+{
+  if (m_enabled)
+  {
+    double& events = *field(EVENTS);
+    events = static_cast<double>(static_cast<uint32_t>(events) | event);
+  }
+}
+
+void FlightRecorder::commit(int64_t stamp_ns)
+{
+  if (!m_enabled)
+  {
+    return;
+  }
+
+  const uint64_t sequence = m_sequence++;
+  std::memcpy(&m_sample[0], &sequence, sizeof(double));
+  std::memcpy(&m_sample[1], &stamp_ns, sizeof(double));
+
+  const uint64_t head = m_head.load(std::memory_order_relaxed);
+  if (head - m_tail.load(std::memory_order_acquire) >= m_slots)
+  {
+    m_dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+  else
+  {
+    std::copy(m_sample.begin(), m_sample.end(), m_ring.begin() + (head % m_slots) * m_record_words);
+    m_head.store(head + 1, std::memory_order_release);
+  }
+  *field(EVENTS) = 0.0;
+}
+
+void FlightRecorder::flush()
+{
+  if (!m_enabled)
+  {
+    return;
+  }
+  drain();
+  ::msync(m_map, m_map_size, MS_SYNC);
+}
+
+void FlightRecorder::drain()
+{
+  std::lock_guard<std::mutex> lock(m_drain_mutex);
+  if (!m_header)
+  {
+    return;
+  }
+
+  const size_t record_size = m_header->record_size;
+  uint64_t tail = m_tail.load(std::memory_order_relaxed);
+  const uint64_t head = m_head.load(std::memory_order_acquire);
+  for (; tail != head; ++tail)
+  {
+    const double* sample = &m_ring[(tail % m_slots) * m_record_words];
+    const uint64_t index = m_header->records_written % m_header->capacity;
+    std::memcpy(m_records + index * record_size, sample, record_size);
+    m_header->records_written++;
+  }
+  m_tail.store(tail, std::memory_order_release);
+  m_header->samples_dropped = m_dropped.load(std::memory_order_relaxed);
+}
+
+void FlightRecorder::run()
+{
+  std::unique_lock<std::mutex> lock(m_thread_mutex);
+  while (!m_stop)
+  {
+    m_wakeup.wait_for(lock, DRAIN_PERIOD, [this]() { return m_stop; });
+    drain();
+  }
+}
+
+void FlightRecorder::stop()
+{
+  m_enabled = false;
+  if (m_thread.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_thread_mutex);
+      m_stop = true;
+    }
+    m_wakeup.notify_one();
+    m_thread.join();
+  }
+  drain();
+
+  std::lock_guard<std::mutex> lock(m_drain_mutex);
+  if (m_map)
+  {
+    ::msync(m_map, m_map_size, MS_SYNC);
+    ::munmap(m_map, m_map_size);
+    m_map = nullptr;
+  }
+  m_header = nullptr;
+  m_records = nullptr;
+  if (m_fd >= 0)
+  {
+    ::close(m_fd);
+    m_fd = -1;
+  }
+}
+
+}
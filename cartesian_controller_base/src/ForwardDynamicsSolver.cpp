@@ -37,13 +37,8 @@
  */
 //-----------------------------------------------------------------------------
 
-#include <algorithm>
 #include <cartesian_controller_base/ForwardDynamicsSolver.h>
-#include <kdl/framevel.hpp>
-#include <kdl/jntarrayvel.hpp>
-#include <map>
 #include <pluginlib/class_list_macros.hpp>
-#include <sstream>
 
 
 /**
@@ -74,55 +69,23 @@ PLUGINLIB_EXPORT_CLASS(cartesian_controller_base::ForwardDynamicsSolver, cartesi
 namespace cartesian_controller_base{
 
   ForwardDynamicsSolver::ForwardDynamicsSolver()
+    : IKSolver(m_solver)
   {
   }
 
   ForwardDynamicsSolver::~ForwardDynamicsSolver(){}
 
-  trajectory_msgs::msg::JointTrajectoryPoint ForwardDynamicsSolver::getJointControlCmds(
+  void ForwardDynamicsSolver::getJointControlCmds(
         rclcpp::Duration period,
-        const ctrl::Vector6D& net_force)
+        const ctrl::Vector6D& net_force,
+        trajectory_msgs::msg::JointTrajectoryPoint& control_cmd)
   {
+    // Pick up parameter changes from the node
+    m_solver.setParameters(m_parameters.get());
 
-    // Compute joint space inertia matrix with actualized link masses
-    buildGenericModel();
-    m_jnt_space_inertia_solver->JntToMass(m_current_positions,m_jnt_space_inertia);
-
-    // Compute joint jacobian
-    m_jnt_jacobian_solver->JntToJac(m_current_positions,m_jnt_jacobian);
-
-    // Compute joint accelerations according to: \f$ \ddot{q} = H^{-1} ( J^T f) \f$
-    m_current_accelerations.data = m_jnt_space_inertia.data.inverse() * m_jnt_jacobian.data.transpose() * net_force;
-
-    // Numerical time integration with the Euler forward method
-    m_current_positions.data = m_last_positions.data + m_last_velocities.data * period.seconds();
-    m_current_velocities.data = m_last_velocities.data + m_current_accelerations.data * period.seconds();
-    m_current_velocities.data *= 0.9;  // 10 % global damping against unwanted null space motion.
-                                       // Will cause exponential slow-down without input.
-    // Make sure positions stay in allowed margins
-    applyJointLimits();
-
-    // Apply results
-    trajectory_msgs::msg::JointTrajectoryPoint control_cmd;
-    for (int i = 0; i < m_number_joints; ++i)
-    {
-      control_cmd.positions.push_back(m_current_positions(i));
-      control_cmd.velocities.push_back(m_current_velocities(i));
-
-      // Accelerations should be left empty. Those values will be interpreted
-      // by most hardware joint drivers as max. tolerated values. As a
-      // consequence, the robot will move very slowly.
-    }
-    control_cmd.time_from_start = period; // valid for this duration
-
-    // Update for the next cycle
-    m_last_positions = m_current_positions;
-    m_last_velocities = m_current_velocities;
-
-    return control_cmd;
+    IKSolver::getJointControlCmds(period, net_force, control_cmd);
   }
 
-
 #if defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
   bool ForwardDynamicsSolver::init(std::shared_ptr<rclcpp_lifecycle::LifecycleNode> nh,
 #else
@@ -132,68 +95,42 @@ namespace cartesian_controller_base{
                                    const KDL::JntArray& upper_pos_limits,
                                    const KDL::JntArray& lower_pos_limits)
   {
-    IKSolver::init(nh, chain, upper_pos_limits, lower_pos_limits);
-
-    if (!buildGenericModel())
+    // Set the initial value if provided at runtime, else use default value.
+    if (!nh->has_parameter(m_params + "/link_mass"))
+    {
+      nh->declare_parameter<double>(m_params + "/link_mass", 0.1);
+    }
+    if (!m_parameters.init(
+          nh,
+          {m_params + "/link_mass"},
+          [this](const rclcpp::Parameter& parameter, core::ForwardDynamicsSolver::Parameters& params, std::string& reason) {
+            if (parameter.get_name() == m_params + "/link_mass")
+            {
+              double link_mass = 0.0;
+              if (!parameters::assign(parameter, link_mass, reason) || link_mass <= 0.0)
+              {
+                reason = parameter.get_name() + " must be finite and > 0";
+                return false;
+              }
+              params.link_mass = link_mass;
+            }
+            return true;
+          }))
     {
-      RCLCPP_ERROR(nh->get_logger(), "Something went wrong in setting up the internal model.");
       return false;
     }
 
-    // Forward dynamics
-    m_jnt_jacobian_solver.reset(new KDL::ChainJntToJacSolver(m_chain));
-    m_jnt_space_inertia_solver.reset(new KDL::ChainDynParam(m_chain,KDL::Vector::Zero()));
-    m_jnt_jacobian.resize(m_number_joints);
-    m_jnt_space_inertia.resize(m_number_joints);
-
-    // Set the initial value if provided at runtime, else use default value.
-    m_min = nh->declare_parameter<double>(m_params + "/link_mass", 0.1);
-
-    RCLCPP_INFO(nh->get_logger(), "Forward dynamics solver initialized");
-    RCLCPP_INFO(nh->get_logger(), "Forward dynamics solver has control over %i joints", m_number_joints);
-
-    return true;
-  }
-
-  bool ForwardDynamicsSolver::buildGenericModel()
-  {
-    // Set all masses and inertias to minimal (yet stable) values.
-    double ip_min = 0.000001;
-    for (size_t i = 0; i < m_chain.segments.size(); ++i)
+    m_solver.setParameters(m_parameters.getNonRT());
+    if (!IKSolver::init(nh, chain, upper_pos_limits, lower_pos_limits))
     {
-      // Fixed joint segment
-      if (m_chain.segments[i].getJoint().getType() == KDL::Joint::None)
-      {
-        m_chain.segments[i].setInertia(
-            KDL::RigidBodyInertia::Zero());
-      }
-      else  // relatively moving segment
-      {
-        m_chain.segments[i].setInertia(
-            KDL::RigidBodyInertia(
-              m_min,                // mass
-              KDL::Vector::Zero(),  // center of gravity
-              KDL::RotationalInertia(
-                ip_min,             // ixx
-                ip_min,             // iyy
-                ip_min              // izz
-                // ixy, ixy, iyz default to 0.0
-                )));
-      }
+      RCLCPP_ERROR(nh->get_logger(), "Something went wrong in setting up the internal model.");
+      return false;
     }
 
-    // Only give the last segment a generic mass and inertia.
-    // See https://arxiv.org/pdf/1908.06252.pdf for a motivation for this setting.
-    double m = 1;
-    double ip = 1;
-    m_chain.segments[m_chain.segments.size()-1].setInertia(
-        KDL::RigidBodyInertia(
-          m,
-          KDL::Vector::Zero(),
-          KDL::RotationalInertia(ip, ip, ip)));
+    RCLCPP_INFO(nh->get_logger(), "Forward dynamics solver initialized");
+    RCLCPP_INFO(nh->get_logger(), "Forward dynamics solver has control over %i joints", m_solver.getNumberJoints());
 
     return true;
   }
 
-
 } // namespace
@@ -39,36 +39,58 @@
 
 #include "hardware_interface/types/hardware_interface_type_values.hpp"
 #include "rclcpp/node.hpp"
-#include <algorithm>
 #include <cartesian_controller_base/IKSolver.h>
 #include <functional>
-#include <kdl/framevel.hpp>
-#include <kdl/jntarrayvel.hpp>
-#include <map>
-#include <sstream>
 
 namespace cartesian_controller_base{
 
-  IKSolver::IKSolver()
+  IKSolver::IKSolver(core::IKSolver& solver)
+    : m_core(solver)
   {
   }
 
   IKSolver::~IKSolver(){}
 
+  void IKSolver::getJointControlCmds(
+        rclcpp::Duration period,
+        const ctrl::Vector6D& net_force,
+        trajectory_msgs::msg::JointTrajectoryPoint& control_cmd)
+  {
+    m_core.computeJointControlCmds(period.seconds(), net_force);
+
+    // Apply results
+    fillJointControlCmds(period, control_cmd);
+  }
+
+  trajectory_msgs::msg::JointTrajectoryPoint IKSolver::getJointControlCmds(
+        rclcpp::Duration period,
+        const ctrl::Vector6D& net_force)
+  {
+    trajectory_msgs::msg::JointTrajectoryPoint control_cmd;
+    control_cmd.positions.resize(m_core.getNumberJoints());
+    control_cmd.velocities.resize(m_core.getNumberJoints());
+    getJointControlCmds(period, net_force, control_cmd);
+    return control_cmd;
+  }
 
   const KDL::Frame& IKSolver::getEndEffectorPose() const
   {
-    return m_end_effector_pose;
+    return m_core.getEndEffectorPose();
   }
 
   const ctrl::Vector6D& IKSolver::getEndEffectorVel() const
   {
-    return m_end_effector_vel;
+    return m_core.getEndEffectorVel();
   }
 
   const KDL::JntArray& IKSolver::getPositions() const
   {
-    return m_current_positions;
+    return m_core.getPositions();
+  }
+
+  const KinematicsCache& IKSolver::getKinematics()
+  {
+    return m_core.getKinematics();
   }
 
 
@@ -76,24 +98,21 @@ namespace cartesian_controller_base{
     const std::vector<std::reference_wrapper<hardware_interface::LoanedStateInterface> >&
       joint_pos_handles)
   {
-    // Copy into internal buffers.
+    m_measured_positions = m_core.getPositions();
     for (size_t i = 0; i < joint_pos_handles.size(); ++i)
     {
       // Interface type should be checked by the caller.
       // Add additional plausibility check just in case.
       if (joint_pos_handles[i].get().get_interface_name() == hardware_interface::HW_IF_POSITION)
       {
-        m_current_positions(i)     = joint_pos_handles[i].get().get_value();
-        m_current_velocities(i)    = 0.0;
-        m_current_accelerations(i) = 0.0;
-        m_last_positions(i)        = m_current_positions(i);
-        m_last_velocities(i)       = m_current_velocities(i);
+        m_measured_positions(i) = joint_pos_handles[i].get().get_value();
       }
       else
       {
         return false;
       }
     }
+    m_core.setStartState(m_measured_positions);
     return true;
   }
 
@@ -102,16 +121,17 @@ namespace cartesian_controller_base{
     const std::vector<std::reference_wrapper<hardware_interface::LoanedStateInterface> >&
       joint_pos_handles)
   {
+    m_measured_positions = m_core.getPositions();
     for (size_t i = 0; i < joint_pos_handles.size(); ++i)
     {
       // Interface type should be checked by the caller.
       // Add additional plausibility check just in case.
       if (joint_pos_handles[i].get().get_interface_name() == hardware_interface::HW_IF_POSITION)
       {
-        m_current_positions(i) = joint_pos_handles[i].get().get_value();
-        m_last_positions(i)    = m_current_positions(i);
+        m_measured_positions(i) = joint_pos_handles[i].get().get_value();
       }
     }
+    m_core.synchronizeJointPositions(m_measured_positions);
   }
 
 
@@ -124,52 +144,41 @@ namespace cartesian_controller_base{
                       const KDL::JntArray& upper_pos_limits,
                       const KDL::JntArray& lower_pos_limits)
   {
-    // Initialize
-    m_chain = chain;
-    m_number_joints              = m_chain.getNrOfJoints();
-    m_current_positions.data     = ctrl::VectorND::Zero(m_number_joints);
-    m_current_velocities.data    = ctrl::VectorND::Zero(m_number_joints);
-    m_current_accelerations.data = ctrl::VectorND::Zero(m_number_joints);
-    m_last_positions.data        = ctrl::VectorND::Zero(m_number_joints);
-    m_last_velocities.data       = ctrl::VectorND::Zero(m_number_joints);
-    m_upper_pos_limits           = upper_pos_limits;
-    m_lower_pos_limits           = lower_pos_limits;
-
-    // Forward kinematics
-    m_fk_pos_solver.reset(new KDL::ChainFkSolverPos_recursive(m_chain));
-    m_fk_vel_solver.reset(new KDL::ChainFkSolverVel_recursive(m_chain));
-
+    if (!m_core.init(chain, upper_pos_limits, lower_pos_limits))
+    {
+      return false;
+    }
+    m_measured_positions.resize(m_core.getNumberJoints());
     return true;
   }
 
   void IKSolver::updateKinematics()
   {
-    // Pose w. r. t. base
-    m_fk_pos_solver->JntToCart(m_current_positions,m_end_effector_pose);
-
-    // Absolute velocity w. r. t. base
-    KDL::FrameVel vel;
-    m_fk_vel_solver->JntToCart(KDL::JntArrayVel(m_current_positions,m_current_velocities),vel);
-    m_end_effector_vel[0] = vel.deriv().vel.x();
-    m_end_effector_vel[1] = vel.deriv().vel.y();
-    m_end_effector_vel[2] = vel.deriv().vel.z();
-    m_end_effector_vel[3] = vel.deriv().rot.x();
-    m_end_effector_vel[4] = vel.deriv().rot.y();
-    m_end_effector_vel[5] = vel.deriv().rot.z();
+    m_core.updateKinematics();
   }
 
-  void IKSolver::applyJointLimits()
+  void IKSolver::fillJointControlCmds(
+        const rclcpp::Duration& period,
+        trajectory_msgs::msg::JointTrajectoryPoint& control_cmd) const
   {
-    for (int i = 0; i < m_number_joints; ++i)
+    const int number_joints = m_core.getNumberJoints();
+    const KDL::JntArray& positions = m_core.getPositions();
+    const KDL::JntArray& velocities = m_core.getVelocities();
+
+    // No-ops if already sized correctly
+    control_cmd.positions.resize(number_joints);
+    control_cmd.velocities.resize(number_joints);
+
+    for (int i = 0; i < number_joints; ++i)
     {
-      if (std::isnan(m_lower_pos_limits(i)) || std::isnan(m_upper_pos_limits(i)))
-      {
-        // Joint marked as continuous.
-        continue;
-      }
-      m_current_positions(i) = std::clamp(
-          m_current_positions(i),m_lower_pos_limits(i),m_upper_pos_limits(i));
+      control_cmd.positions[i] = positions(i);
+      control_cmd.velocities[i] = velocities(i);
+
+      // Accelerations should be left empty. Those values will be interpreted
+      // by most hardware joint drivers as max. tolerated values. As a
+      // consequence, the robot will move very slowly.
     }
+    control_cmd.time_from_start = period; // valid for this duration
   }
 
 } // namespace
@@ -0,0 +1,221 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    KinematicsCache.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <cartesian_controller_base/KinematicsCache.h>
+
+namespace cartesian_controller_base
+{
+
+std::vector<CollapsedSegment> collapseFixedSegments(const KDL::Chain& chain, KDL::Chain& collapsed)
+{
+  std::vector<CollapsedSegment> origins(chain.getNrOfSegments());
+  collapsed = KDL::Chain();
+
+  // Each group starts with a moving segment, or with the chain's first
+  // segment, and extends over all directly following fixed segments.
+  const size_t nr_segments = chain.segments.size();
+  size_t begin = 0;
+  while (begin < nr_segments)
+  {
+    size_t end = begin + 1;
+    while (end < nr_segments && chain.segments[end].getJoint().getType() == KDL::Joint::None)
+    {
+      ++end;
+    }
+
+    KDL::Frame tip = chain.segments[begin].getFrameToTip();
+    for (size_t s = begin + 1; s < end; ++s)
+    {
+      tip = tip * chain.segments[s].getFrameToTip();
+    }
+
+    // Poses of the original tips in the merged tip, from the last one back
+    const int index = static_cast<int>(collapsed.getNrOfSegments());
+    KDL::Frame offset = KDL::Frame::Identity();
+    for (size_t s = end; s-- > begin;)
+    {
+      origins[s] = {index, offset};
+      offset = offset * chain.segments[s].getFrameToTip().Inverse();
+    }
+
+    collapsed.addSegment(KDL::Segment(
+          chain.segments[end - 1].getName(), chain.segments[begin].getJoint(), tip));
+    begin = end;
+  }
+  return origins;
+}
+
+KinematicsCache::KinematicsCache()
+  : m_tool_index(0), m_valid(false)
+{
+}
+
+KinematicsCache::~KinematicsCache()
+{
+}
+
+void KinematicsCache::init(const KDL::Chain& chain)
+{
+  KDL::Chain collapsed;
+  const std::vector<CollapsedSegment> origins = collapseFixedSegments(chain, collapsed);
+
+  // Original links in the poses of the collapsed chain.  Only links that
+  // aren't the tip of a merged group need an offset.
+  m_link_names.clear();
+  m_anchors.clear();
+  m_anchors.push_back({0, false, KDL::Frame::Identity()});
+  for (size_t s = 0; s < origins.size(); ++s)
+  {
+    const bool group_tip = s + 1 == origins.size() || origins[s + 1].segment != origins[s].segment;
+    m_anchors.push_back({origins[s].segment + 1, !group_tip, origins[s].offset});
+    m_link_names.push_back(chain.segments[s].getName());
+  }
+
+  m_elements.clear();
+  m_joint_elements.clear();
+  for (const auto& segment : collapsed.segments)
+  {
+    const KDL::Joint& joint = segment.getJoint();
+
+    Element element;
+    element.joint     = joint;
+    element.moving    = joint.getType() != KDL::Joint::None;
+    element.prismatic = joint.getType() == KDL::Joint::TransAxis ||
+                        joint.getType() == KDL::Joint::TransX ||
+                        joint.getType() == KDL::Joint::TransY ||
+                        joint.getType() == KDL::Joint::TransZ;
+    element.axis      = joint.JointAxis();
+    element.origin    = joint.JointOrigin();
+    element.tip       = joint.pose(0.0).Inverse() * segment.getFrameToTip();
+
+    if (element.moving)
+    {
+      m_joint_elements.push_back(m_elements.size());
+    }
+    m_elements.push_back(element);
+  }
+
+  m_frames.assign(m_elements.size() + 1, KDL::Frame::Identity());
+  m_joint_axes.assign(chain.getNrOfJoints(), KDL::Vector::Zero());
+  m_joint_origins.assign(chain.getNrOfJoints(), KDL::Vector::Zero());
+  m_jacobian.resize(chain.getNrOfJoints());
+  m_positions.resize(chain.getNrOfJoints());
+
+  // The chain's tip
+  m_tool_index = getNrOfFrames() - 1;
+  m_tool_offset = KDL::Frame::Identity();
+  m_tool_frame = KDL::Frame::Identity();
+  m_valid = false;
+}
+
+void KinematicsCache::setTool(int index, const KDL::Frame& offset)
+{
+  m_tool_index = index;
+  m_tool_offset = offset;
+  m_valid = false;
+}
+
+int KinematicsCache::linkIndex(const std::string& link) const
+{
+  for (size_t i = 0; i < m_link_names.size(); ++i)
+  {
+    if (m_link_names[i] == link)
+    {
+      return static_cast<int>(i + 1);
+    }
+  }
+  return -1;
+}
+
+bool KinematicsCache::update(const KDL::JntArray& positions)
+{
+  if (m_valid && positions.data == m_positions.data)
+  {
+    return false;
+  }
+
+  // One pass from root to tip.
+  // Fixed segments don't consume joint positions.
+  unsigned int j = 0;
+  for (size_t i = 0; i < m_elements.size(); ++i)
+  {
+    const Element& element = m_elements[i];
+    const KDL::Frame& root = m_frames[i];
+    if (element.moving)
+    {
+      m_joint_axes[j] = root.M * element.axis;
+      m_joint_origins[j] = root * element.origin;
+      m_frames[i + 1] = root * element.joint.pose(positions(j)) * element.tip;
+      ++j;
+    }
+    else
+    {
+      m_frames[i + 1] = root * element.tip;
+    }
+  }
+
+  m_tool_frame = getFrame(m_tool_index) * m_tool_offset;
+
+  // Jacobian columns with the reference point in the TCP.
+  // Joints behind the TCP's link don't move it.
+  const KDL::Vector& p_ee = m_tool_frame.p;
+  const size_t tool_element = m_anchors[m_tool_index].frame;
+  for (j = 0; j < m_joint_elements.size(); ++j)
+  {
+    const KDL::Vector& z = m_joint_axes[j];
+    if (m_joint_elements[j] >= tool_element)
+    {
+      m_jacobian.setColumn(j, KDL::Twist::Zero());
+    }
+    else if (m_elements[m_joint_elements[j]].prismatic)
+    {
+      m_jacobian.setColumn(j, KDL::Twist(z, KDL::Vector::Zero()));
+    }
+    else
+    {
+      m_jacobian.setColumn(j, KDL::Twist(z * (p_ee - m_joint_origins[j]), z));
+    }
+  }
+
+  m_positions.data = positions.data;
+  m_valid = true;
+  return true;
+}
+
+}
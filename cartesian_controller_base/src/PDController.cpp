@@ -45,7 +45,6 @@ namespace cartesian_controller_base
 {
 
 PDController::PDController()
-  : m_last_p_error(0.0)
 {
 }
 
@@ -55,42 +54,47 @@ PDController::~PDController()
 
 
 #if defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
-void PDController::init(const std::string& params, std::shared_ptr<rclcpp_lifecycle::LifecycleNode> handle)
+bool PDController::init(const std::string& params, std::shared_ptr<rclcpp_lifecycle::LifecycleNode> handle)
 #else
-void PDController::init(const std::string& params, std::shared_ptr<rclcpp::Node> handle)
+bool PDController::init(const std::string& params, std::shared_ptr<rclcpp::Node> handle)
 #endif
 {
   m_params = params;
-  m_handle = std::move(handle);
 
-  auto auto_declare = [this](const std::string& s)
+  auto auto_declare = [&handle](const std::string& s)
   {
-    if (!m_handle->has_parameter(s))
+    if (!handle->has_parameter(s))
     {
-      return m_handle->declare_parameter<double>(s, 0.0);
+      return handle->declare_parameter<double>(s, 0.0);
     }
-    return m_handle->get_parameter(s).as_double();
+    return handle->get_parameter(s).as_double();
   };
 
   auto_declare(m_params + ".p");
   auto_declare(m_params + ".d");
+
+  return m_gains.init(
+    handle,
+    {m_params + ".p", m_params + ".d"},
+    [this](const rclcpp::Parameter& parameter, Gains& gains, std::string& reason) {
+      if (parameter.get_name() == m_params + ".p")
+      {
+        return parameters::assign(parameter, gains.p, reason, 0.0);
+      }
+      if (parameter.get_name() == m_params + ".d")
+      {
+        return parameters::assign(parameter, gains.d, reason, 0.0);
+      }
+      return true;
+    });
 }
 
 
 double PDController::operator()(const double& error, const rclcpp::Duration& period)
 {
-  if (period == rclcpp::Duration::from_seconds(0.0))
-  {
-    return 0.0;
-  }
-
   // Get latest gains
-  m_handle->get_parameter(m_params + ".p", m_p);
-  m_handle->get_parameter(m_params + ".d", m_d);
-  double result = m_p * error + m_d * (error - m_last_p_error) / period.seconds();
-
-  m_last_p_error = error;
-  return result;
+  m_controller.setGains(m_gains.get());
+  return m_controller(error, period.seconds());
 }
 
 
@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    RobotModel.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <cartesian_controller_base/RobotModel.h>
+#include <cmath>
+#include <functional>
+#include <kdl/tree.hpp>
+#include <kdl_parser/kdl_parser.hpp>
+#include <mutex>
+#include <tuple>
+#include <urdf/model.h>
+#include <urdf_model/joint.h>
+
+namespace cartesian_controller_base
+{
+
+namespace
+{
+
+std::shared_ptr<RobotModel> buildRobotModel(const std::string& robot_description,
+                                            const std::string& robot_base_link,
+                                            const std::string& end_effector_link,
+                                            std::string& error)
+{
+  urdf::Model robot_model;
+  KDL::Tree   robot_tree;
+  auto model = std::make_shared<RobotModel>();
+
+  // Build a kinematic chain of the robot
+  if (!robot_model.initString(robot_description))
+  {
+    error = "Failed to parse urdf model from 'robot_description'";
+    return nullptr;
+  }
+  if (!kdl_parser::treeFromUrdfModel(robot_model,robot_tree))
+  {
+    error = "Failed to parse KDL tree from urdf model";
+    return nullptr;
+  }
+  if (!robot_tree.getChain(robot_base_link,end_effector_link,model->chain))
+  {
+    error = ""
+      "Failed to parse robot chain from urdf model. "
+      "Do robot_base_link and end_effector_link exist?";
+    return nullptr;
+  }
+
+  // Parse joint limits
+  for (const auto& joint : robot_model.joints_)
+  {
+    RobotModel::Limits& limits = model->limits[joint.first];
+    if (joint.second->type == urdf::Joint::CONTINUOUS)
+    {
+      limits.upper = std::nan("0");
+      limits.lower = std::nan("0");
+    }
+    else if (joint.second->limits)
+    {
+      limits.upper = joint.second->limits->upper;
+      limits.lower = joint.second->limits->lower;
+    }
+  }
+
+  model->description = robot_description;
+  model->robot_base_link = robot_base_link;
+  model->end_effector_link = end_effector_link;
+  return model;
+}
+
+} // namespace
+
+bool RobotModel::jointLimits(const std::vector<std::string>& joint_names,
+                             KDL::JntArray& upper_pos_limits,
+                             KDL::JntArray& lower_pos_limits,
+                             std::string& error) const
+{
+  upper_pos_limits.resize(joint_names.size());
+  lower_pos_limits.resize(joint_names.size());
+  for (size_t i = 0; i < joint_names.size(); ++i)
+  {
+    const auto joint = limits.find(joint_names[i]);
+    if (joint == limits.end())
+    {
+      error = "Joint " + joint_names[i] + " does not appear in robot_description";
+      return false;
+    }
+    upper_pos_limits(i) = joint->second.upper;
+    lower_pos_limits(i) = joint->second.lower;
+  }
+  return true;
+}
+
+std::shared_ptr<const RobotModel> loadRobotModel(const std::string& robot_description,
+                                                 const std::string& robot_base_link,
+                                                 const std::string& end_effector_link,
+                                                 std::string& error)
+{
+  using Key = std::tuple<size_t, std::string, std::string>;
+  static std::mutex mutex;
+  static std::multimap<Key, std::weak_ptr<const RobotModel> > registry;
+
+  const Key key(std::hash<std::string>{}(robot_description), robot_base_link, end_effector_link);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  for (auto entry = registry.begin(); entry != registry.end();)
+  {
+    // Forget models without users
+    std::shared_ptr<const RobotModel> model = entry->second.lock();
+    if (!model)
+    {
+      entry = registry.erase(entry);
+      continue;
+    }
+
+    // Hashes may collide
+    if (entry->first == key && model->description == robot_description)
+    {
+      return model;
+    }
+    ++entry;
+  }
+
+  std::shared_ptr<const RobotModel> model =
+    buildRobotModel(robot_description, robot_base_link, end_effector_link, error);
+  if (model)
+  {
+    registry.emplace(key, model);
+  }
+  return model;
+}
+
+bool parseRobotModel(const std::string& robot_description,
+                     const std::string& robot_base_link,
+                     const std::string& end_effector_link,
+                     const std::vector<std::string>& joint_names,
+                     KDL::Chain& chain,
+                     KDL::JntArray& upper_pos_limits,
+                     KDL::JntArray& lower_pos_limits,
+                     std::string& error)
+{
+  const auto model = loadRobotModel(robot_description, robot_base_link, end_effector_link, error);
+  if (!model)
+  {
+    return false;
+  }
+  chain = model->chain;
+  return model->jointLimits(joint_names, upper_pos_limits, lower_pos_limits, error);
+}
+
+}
@@ -38,7 +38,6 @@
 //-----------------------------------------------------------------------------
 
 #include <cartesian_controller_base/SelectivelyDampedLeastSquaresSolver.h>
-#include <memory>
 #include <pluginlib/class_list_macros.hpp>
 
 /**
@@ -64,81 +63,12 @@ PLUGINLIB_EXPORT_CLASS(cartesian_controller_base::SelectivelyDampedLeastSquaresS
 namespace cartesian_controller_base{
 
   SelectivelyDampedLeastSquaresSolver::SelectivelyDampedLeastSquaresSolver()
+    : IKSolver(m_solver)
   {
   }
 
   SelectivelyDampedLeastSquaresSolver::~SelectivelyDampedLeastSquaresSolver(){}
 
-  trajectory_msgs::msg::JointTrajectoryPoint SelectivelyDampedLeastSquaresSolver::getJointControlCmds(
-        rclcpp::Duration period,
-        const ctrl::Vector6D& net_force)
-  {
-    // Compute joint Jacobian
-    m_jnt_jacobian_solver->JntToJac(m_current_positions,m_jnt_jacobian);
-
-    Eigen::JacobiSVD<Eigen::Matrix<double, 6, Eigen::Dynamic> > JSVD(
-      m_jnt_jacobian.data, Eigen::ComputeFullU | Eigen::ComputeFullV);
-    Eigen::Matrix<double, 6, 6> U = JSVD.matrixU();
-    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> V = JSVD.matrixV();
-    Eigen::Matrix<double, Eigen::Dynamic, 1> s = JSVD.singularValues();
-
-    // Default recommendation by Buss and Kim.
-    const double gamma_max = 3.141592653 / 4;
-
-    Eigen::Matrix<double, Eigen::Dynamic, 1> sum_phi =
-      Eigen::Matrix<double, Eigen::Dynamic, 1>::Zero(m_number_joints);
-
-    // Compute each joint velocity with the SDLS method.  This implements the
-    // algorithm as described in the paper (but for only one end-effector).
-    // Also see Buss' own implementation:
-    // https://www.math.ucsd.edu/~sbuss/ResearchWeb/ikmethods/index.html
-
-    for (int i = 0; i < m_number_joints; ++i)
-    {
-      double alpha = U.col(i).transpose() * net_force;
-
-      double N = U.col(i).head(3).norm();
-      double M = 0;
-      for (int j = 0; j < m_number_joints; ++j)
-      {
-        double rho = m_jnt_jacobian.data.col(j).head(3).norm();
-        M += std::abs(V.col(i)[j]) * rho;
-      }
-      M *= 1.0 / s[i];
-
-      double gamma = std::min(1.0, N / M) * gamma_max;
-
-      Eigen::Matrix<double, Eigen::Dynamic, 1> phi = clampMaxAbs(1.0 / s[i] * alpha * V.col(i), gamma);
-      sum_phi += phi;
-    }
-
-    m_current_velocities.data = clampMaxAbs(sum_phi, gamma_max);
-
-    // Integrate once, starting with zero motion
-    m_current_positions.data = m_last_positions.data + 0.5 * m_current_velocities.data * period.seconds();
-
-    // Make sure positions stay in allowed margins
-    applyJointLimits();
-
-    // Apply results
-    trajectory_msgs::msg::JointTrajectoryPoint control_cmd;
-    for (int i = 0; i < m_number_joints; ++i)
-    {
-      control_cmd.positions.push_back(m_current_positions(i));
-      control_cmd.velocities.push_back(m_current_velocities(i));
-
-      // Accelerations should be left empty. Those values will be interpreted
-      // by most hardware joint drivers as max. tolerated values. As a
-      // consequence, the robot will move very slowly.
-    }
-    control_cmd.time_from_start = period; // valid for this duration
-
-    // Update for the next cycle
-    m_last_positions = m_current_positions;
-
-    return control_cmd;
-  }
-
 #if defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
   bool SelectivelyDampedLeastSquaresSolver::init(std::shared_ptr<rclcpp_lifecycle::LifecycleNode> nh,
 #else
@@ -148,25 +78,7 @@ namespace cartesian_controller_base{
                                       const KDL::JntArray& upper_pos_limits,
                                       const KDL::JntArray& lower_pos_limits)
   {
-    IKSolver::init(nh, chain, upper_pos_limits, lower_pos_limits);
-
-    m_jnt_jacobian_solver.reset(new KDL::ChainJntToJacSolver(m_chain));
-    m_jnt_jacobian.resize(m_number_joints);
-
-    return true;
-  }
-
-  Eigen::Matrix<double, Eigen::Dynamic, 1> SelectivelyDampedLeastSquaresSolver::clampMaxAbs(
-    const Eigen::Matrix<double, Eigen::Dynamic, 1>& w, double d)
-  {
-    if (w.cwiseAbs().maxCoeff() <= d)
-    {
-      return w;
-    }
-    else
-    {
-      return d * w / w.cwiseAbs().maxCoeff();
-    }
+    return IKSolver::init(nh, chain, upper_pos_limits, lower_pos_limits);
   }
 
 } // namespace
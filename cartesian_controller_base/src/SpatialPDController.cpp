@@ -49,12 +49,13 @@ SpatialPDController::SpatialPDController()
 
 ctrl::Vector6D SpatialPDController::operator()(const ctrl::Vector6D& error, const rclcpp::Duration& period)
 {
-  // Perform pd control separately on each Cartesian dimension
+  // Get latest gains
   for (int i = 0; i < 6; ++i) // 3 transition, 3 rotation
   {
-    m_cmd(i) = m_pd_controllers[i](error[i],period);
+    m_gains[i] = m_pd_controllers[i].getGains();
   }
-  return m_cmd;
+  m_controller.setGains(m_gains);
+  return m_controller(error, period.seconds());
 }
 
 #if defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
@@ -63,23 +64,15 @@ bool SpatialPDController::init(std::shared_ptr<rclcpp_lifecycle::LifecycleNode>
 bool SpatialPDController::init(std::shared_ptr<rclcpp::Node> handle)
 #endif
 {
-  // Create pd controllers for each Cartesian dimension
-  for (int i = 0; i < 6; ++i) // 3 transition, 3 rotation
-  {
-    m_pd_controllers.push_back(PDController());
-  }
-
   // Load default controller gains
   std::string gains_config = "pd_gains";
 
-  m_pd_controllers[0].init(gains_config + ".trans_x", handle);
-  m_pd_controllers[1].init(gains_config + ".trans_y", handle);
-  m_pd_controllers[2].init(gains_config + ".trans_z", handle);
-  m_pd_controllers[3].init(gains_config + ".rot_x", handle);
-  m_pd_controllers[4].init(gains_config + ".rot_y", handle);
-  m_pd_controllers[5].init(gains_config + ".rot_z", handle);
-
-  return true;
+  return m_pd_controllers[0].init(gains_config + ".trans_x", handle) &&
+         m_pd_controllers[1].init(gains_config + ".trans_y", handle) &&
+         m_pd_controllers[2].init(gains_config + ".trans_z", handle) &&
+         m_pd_controllers[3].init(gains_config + ".rot_x", handle) &&
+         m_pd_controllers[4].init(gains_config + ".rot_y", handle) &&
+         m_pd_controllers[5].init(gains_config + ".rot_z", handle);
 }
 
 } // namespace
@@ -43,21 +43,39 @@
 #include "geometry_msgs/msg/detail/twist_stamped__struct.hpp"
 #include "hardware_interface/types/hardware_interface_type_values.hpp"
 #include "rclcpp_lifecycle/node_interfaces/lifecycle_node_interface.hpp"
+#include <cartesian_controller_base/RobotModel.h>
 #include <cartesian_controller_base/cartesian_controller_base.h>
+#include <algorithm>
+#include <cartesian_controller_base/core/CartesianMath.h>
 #include <cmath>
 #include <kdl/jntarray.hpp>
-#include <kdl/tree.hpp>
-#include <kdl_parser/kdl_parser.hpp>
-#include <urdf/model.h>
-#include <urdf_model/joint.h>
 
 namespace cartesian_controller_base
 {
 
+namespace
+{
+  //! How often the reload thread checks for a swapped-out model to release
+  constexpr std::chrono::milliseconds MODEL_RELEASE_PERIOD(100);
+}
+
 CartesianControllerBase::CartesianControllerBase()
 {
 }
 
+CartesianControllerBase::~CartesianControllerBase()
+{
+  if (m_reload_thread.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_reload_mutex);
+      m_reload_stop = true;
+    }
+    m_reload_wakeup.notify_one();
+    m_reload_thread.join();
+  }
+}
+
 controller_interface::InterfaceConfiguration CartesianControllerBase::command_interface_configuration() const
 {
   controller_interface::InterfaceConfiguration conf;
@@ -99,6 +117,16 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn Cartes
     auto_declare<double>("solver.error_scale", 1.0);
     auto_declare<int>("solver.iterations", 1);
     auto_declare<bool>("solver.publish_state_feedback", false);
+    auto_declare<double>("solver.convergence.error_threshold", 0.0);
+    auto_declare<double>("solver.convergence.velocity_threshold", 0.0);
+    auto_declare<double>("solver.time_budget", 0.0);
+    auto_declare<int>("solver.decimation", 1);
+    auto_declare<int>("solver.interpolation_order", 1);
+    auto_declare<bool>("flight_recorder.enabled", false);
+    auto_declare<std::string>("flight_recorder.file", "");
+    auto_declare<int>("flight_recorder.capacity", 60000);
+    auto_declare<bool>("hot_standby", false);
+    auto_declare<bool>("reload_robot_description", false);
     
     m_robot_description_subscription = get_node()->create_subscription<std_msgs::msg::String>(
       "/robot_description", rclcpp::QoS(1).transient_local(),
@@ -137,6 +165,16 @@ controller_interface::return_type CartesianControllerBase::init(const std::strin
     auto_declare<double>("solver.error_scale", 1.0);
     auto_declare<int>("solver.iterations", 1);
     auto_declare<bool>("solver.publish_state_feedback", false);
+    auto_declare<double>("solver.convergence.error_threshold", 0.0);
+    auto_declare<double>("solver.convergence.velocity_threshold", 0.0);
+    auto_declare<double>("solver.time_budget", 0.0);
+    auto_declare<int>("solver.decimation", 1);
+    auto_declare<int>("solver.interpolation_order", 1);
+    auto_declare<bool>("flight_recorder.enabled", false);
+    auto_declare<std::string>("flight_recorder.file", "");
+    auto_declare<int>("flight_recorder.capacity", 60000);
+    auto_declare<bool>("hot_standby", false);
+    auto_declare<bool>("reload_robot_description", false);
 
     m_initialized = true;
   }
@@ -165,11 +203,9 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn Cartes
     RCLCPP_ERROR(get_node()->get_logger(), ex.what());
     return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
   }
+  m_ik_solver_name = ik_solver;
 
   // Get kinematics specific configuration
-  urdf::Model robot_model;
-  KDL::Tree   robot_tree;
-
   m_robot_description = get_node()->get_parameter("robot_description").as_string();
   // m_robot_description_flag = true;
   // RCLCPP_ERROR(get_node()->get_logger(), "get robot_description");
@@ -191,67 +227,106 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn Cartes
     return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
   }
 
-  // Build a kinematic chain of the robot
-  if (!robot_model.initString(m_robot_description))
+  // Get names of actuated joints
+  m_joint_names = get_node()->get_parameter("joints").as_string_array();
+  if (m_joint_names.empty())
   {
-    RCLCPP_ERROR(get_node()->get_logger(), "Failed to parse urdf model from 'robot_description'");
+    RCLCPP_ERROR(get_node()->get_logger(), "joints array is empty");
     return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
   }
-  if (!kdl_parser::treeFromUrdfModel(robot_model,robot_tree))
+
+  // Build a kinematic chain of the robot and parse joint limits.
+  // Other controllers of this robot in the process share the model.
+  KDL::JntArray upper_pos_limits;
+  KDL::JntArray lower_pos_limits;
+  std::string error;
+  m_robot_model = loadRobotModel(m_robot_description, m_robot_base_link, m_end_effector_link, error);
+  if (!m_robot_model ||
+      !m_robot_model->jointLimits(m_joint_names, upper_pos_limits, lower_pos_limits, error))
   {
-    RCLCPP_ERROR(get_node()->get_logger(), "Failed to parse KDL tree from urdf model");
+    RCLCPP_ERROR(get_node()->get_logger(), error.c_str());
     return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
   }
-  if (!robot_tree.getChain(m_robot_base_link,m_end_effector_link,m_robot_chain))
+  m_robot_chain = m_robot_model->chain;
+
+  // Initialize solvers
+  if (!m_ik_solver->init(get_node(),m_robot_chain,upper_pos_limits,lower_pos_limits))
   {
-    const std::string error = ""
-      "Failed to parse robot chain from urdf model. "
-      "Do robot_base_link and end_effector_link exist?";
-    RCLCPP_ERROR(get_node()->get_logger(), error.c_str());
+    RCLCPP_ERROR(get_node()->get_logger(), "Failed to initialize the IK solver %s", ik_solver.c_str());
     return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
   }
 
-  // Get names of actuated joints
-  m_joint_names = get_node()->get_parameter("joints").as_string_array();
-  if (m_joint_names.empty())
+  // Preallocate the solver's output buffer for allocation-free control cycles
+  m_simulated_joint_motion.positions.resize(m_robot_chain.getNrOfJoints());
+  m_simulated_joint_motion.velocities.resize(m_robot_chain.getNrOfJoints());
+
+  m_end_effector_index = linkIndex(m_end_effector_link);
+  m_iterations = get_node()->get_parameter("solver.iterations").as_int();
+
+  // Solve every m_decimation cycles and extrapolate in between
+  m_decimation = get_node()->get_parameter("solver.decimation").as_int();
+  if (m_decimation < 1)
   {
-    RCLCPP_ERROR(get_node()->get_logger(), "joints array is empty");
+    RCLCPP_ERROR(get_node()->get_logger(), "solver.decimation must be >= 1");
     return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
   }
-
-  // Parse joint limits
-  KDL::JntArray upper_pos_limits(m_joint_names.size());
-  KDL::JntArray lower_pos_limits(m_joint_names.size());
-  for (size_t i = 0; i < m_joint_names.size(); ++i)
+  m_extrapolator.init(upper_pos_limits, lower_pos_limits);
+
+  // Realtime-safe access to the solver's dynamic parameters
+  if (!m_solver_parameters.init(
+        get_node(),
+        {"solver.error_scale",
+         "solver.publish_state_feedback",
+         "solver.convergence.error_threshold",
+         "solver.convergence.velocity_threshold",
+         "solver.time_budget",
+         "solver.interpolation_order"},
+        [](const rclcpp::Parameter& parameter, SolverParameters& params, std::string& reason) {
+          if (parameter.get_name() == "solver.error_scale")
+          {
+            return parameters::assign(parameter, params.error_scale, reason, 0.0);
+          }
+          if (parameter.get_name() == "solver.publish_state_feedback")
+          {
+            return parameters::assign(parameter, params.publish_state_feedback, reason);
+          }
+          if (parameter.get_name() == "solver.convergence.error_threshold")
+          {
+            return parameters::assign(parameter, params.convergence_error_threshold, reason, 0.0);
+          }
+          if (parameter.get_name() == "solver.convergence.velocity_threshold")
+          {
+            return parameters::assign(parameter, params.convergence_velocity_threshold, reason, 0.0);
+          }
+          if (parameter.get_name() == "solver.time_budget")
+          {
+            if (!parameters::assign(parameter, params.time_budget, reason, 0.0))
+            {
+              return false;
+            }
+            if (params.time_budget > 1.0)
+            {
+              reason = parameter.get_name() + " is a fraction of the control period and must be <= 1.0";
+              return false;
+            }
+          }
+          if (parameter.get_name() == "solver.interpolation_order")
+          {
+            return parameters::assign(
+              parameter, params.interpolation_order, reason, 0, core::CommandExtrapolator::MAX_ORDER);
+          }
+          return true;
+        }))
   {
-    if (!robot_model.getJoint(m_joint_names[i]))
-    {
-      RCLCPP_ERROR(get_node()->get_logger(), "Joint %s does not appear in robot_description", m_joint_names[i].c_str());
-      return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
-    }
-    if (robot_model.getJoint(m_joint_names[i])->type == urdf::Joint::CONTINUOUS)
-    {
-      upper_pos_limits(i) = std::nan("0");
-      lower_pos_limits(i) = std::nan("0");
-    }
-    else
-    {
-      // Non-existent urdf limits are zero initialized
-      upper_pos_limits(i) = robot_model.getJoint(m_joint_names[i])->limits->upper;
-      lower_pos_limits(i) = robot_model.getJoint(m_joint_names[i])->limits->lower;
-    }
+    return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
   }
 
-  // Initialize solvers
-  m_ik_solver->init(get_node(),m_robot_chain,upper_pos_limits,lower_pos_limits);
-  KDL::Tree tmp("not_relevant");
-  tmp.addChain(m_robot_chain,"not_relevant");
-  m_forward_kinematics_solver.reset(new KDL::TreeFkSolverPos_recursive(tmp));
-  m_iterations = get_node()->get_parameter("solver.iterations").as_int();
-  m_error_scale = get_node()->get_parameter("solver.error_scale").as_double();
-
   // Initialize Cartesian pd controllers
-  m_spatial_controller.init(get_node());
+  if (!m_spatial_controller.init(get_node()))
+  {
+    RCLCPP_ERROR(get_node()->get_logger(), "Failed to initialize the Cartesian pd controllers");
+    return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
+  }
 
   // Check command interfaces.
   // We support position, velocity, or both.
@@ -284,6 +359,60 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn Cartes
       get_node()->create_publisher<geometry_msgs::msg::TwistStamped>(
         std::string(get_node()->get_name()) + "/current_twist", 3));
 
+  // Periodic reports on the solver's behavior, published outside the control cycle
+  m_diagnostics = std::make_shared<diagnostic_updater::Updater>(get_node());
+  m_diagnostics->setHardwareID(get_node()->get_name());
+  m_diagnostics->add("solver", this, &CartesianControllerBase::produceSolverDiagnostics);
+  m_last_solver_report = std::chrono::steady_clock::now();
+#ifdef CARTESIAN_CONTROLLERS_LATENCY_HISTOGRAMS
+  m_diagnostics->add("latency", this, &CartesianControllerBase::produceLatencyDiagnostics);
+#endif
+
+  // Opt-in post-mortem recording
+  if (get_node()->get_parameter("flight_recorder.enabled").as_bool())
+  {
+    std::string file = get_node()->get_parameter("flight_recorder.file").as_string();
+    if (file.empty())
+    {
+      file = "/tmp/" + std::string(get_node()->get_name()) + ".flight";
+    }
+    const int64_t capacity = get_node()->get_parameter("flight_recorder.capacity").as_int();
+    if (capacity <= 0 ||
+        !m_flight_recorder.init(
+          file, m_robot_chain.getNrOfJoints(), NUM_LATENCY_STAGES, capacity, get_node()->get_logger()))
+    {
+      RCLCPP_ERROR(get_node()->get_logger(), "Failed to initialize the flight recorder");
+      return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
+    }
+  }
+
+  // Follow the real robot while inactive
+  if (get_node()->get_parameter("hot_standby").as_bool())
+  {
+    m_standby_positions.resize(m_robot_chain.getNrOfJoints());
+    m_standby_velocities.resize(m_robot_chain.getNrOfJoints());
+    m_joint_state_subscription = get_node()->create_subscription<sensor_msgs::msg::JointState>(
+      "/joint_states",
+      3,
+      std::bind(&CartesianControllerBase::jointStateCallback, this, std::placeholders::_1));
+  }
+
+  // Control the end effector until a different TCP arrives
+  m_tool_frame.link = m_end_effector_index;
+  m_tool_frame.offset = KDL::Frame::Identity();
+  recordToolFrame();
+  m_tool_frame_subscription = get_node()->create_subscription<geometry_msgs::msg::PoseStamped>(
+    get_node()->get_name() + std::string("/tool_frame"),
+    3,
+    std::bind(&CartesianControllerBase::toolFrameCallback, this, std::placeholders::_1));
+
+  // Follow updates of the robot description
+  m_reload_robot_description = get_node()->get_parameter("reload_robot_description").as_bool();
+  if (m_reload_robot_description)
+  {
+    m_reload_thread = std::thread(&CartesianControllerBase::runReloadThread, this);
+  }
+
   m_configured = true;
 
   return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::SUCCESS;
@@ -294,6 +423,7 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn Cartes
 {
   stopCurrentMotion();
 
+  std::lock_guard<std::mutex> lock(m_standby_mutex);
   if (m_active)
   {
     m_joint_cmd_pos_handles.clear();
@@ -301,6 +431,7 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn Cartes
     m_joint_state_pos_handles.clear();
     this->release_interfaces();
     m_active = false;
+    m_standby_synchronized = false;
   }
   return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::SUCCESS;
 }
@@ -308,6 +439,7 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn Cartes
 rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn CartesianControllerBase::on_activate(
     const rclcpp_lifecycle::State & previous_state)
 {
+  std::lock_guard<std::mutex> lock(m_standby_mutex);
   if (m_active)
   {
     return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::SUCCESS;
@@ -348,16 +480,33 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn Cartes
     return CallbackReturn::ERROR;
   }
 
-  // Copy joint state to internal simulation
-  if (!m_ik_solver->setStartState(m_joint_state_pos_handles))
+  // Continue a recent hot standby.  Its measured joint velocities carry over
+  // into the internal simulation, and the positions come from the state
+  // interfaces.  Otherwise, copy joint state to internal simulation and start
+  // at rest.
+  constexpr double max_standby_age = 0.1;  // sec
+  m_flight_recorder.event(FlightRecorder::ACTIVATION);
+  if (m_standby_synchronized && (get_node()->now() - m_standby_stamp).seconds() < max_standby_age)
+  {
+    m_ik_solver->core().setStartState(m_standby_positions, m_standby_velocities);
+    m_ik_solver->synchronizeJointPositions(m_joint_state_pos_handles);
+    m_flight_recorder.event(FlightRecorder::HOT_STANDBY);
+  }
+  else if (!m_ik_solver->setStartState(m_joint_state_pos_handles))
   {
     RCLCPP_ERROR(get_node()->get_logger(), "Could not set start state");
     return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
   };
+  m_flight_recorder.set(FlightRecorder::START_VELOCITIES, m_ik_solver->core().getVelocities().data);
+  applyToolFrame();
   m_ik_solver->updateKinematics();
 
   // Provide safe command buffers with starting where we are
   computeJointControlCmds(ctrl::Vector6D::Zero(), rclcpp::Duration::from_seconds(0));
+  m_extrapolator.reset(m_simulated_joint_motion.positions, m_simulated_joint_motion.velocities);
+  m_decimation_counter = 0;
+  m_solver_cycle = true;
+  m_last_iterations.store(0, std::memory_order_relaxed);
   writeJointControlCmds();
 
   m_active = true;
@@ -369,6 +518,7 @@ CartesianControllerBase::on_shutdown(const rclcpp_lifecycle::State& previous_sta
 {
   stopCurrentMotion();
 
+  std::lock_guard<std::mutex> lock(m_standby_mutex);
   if (m_active)
   {
     m_joint_cmd_pos_handles.clear();
@@ -376,14 +526,251 @@ CartesianControllerBase::on_shutdown(const rclcpp_lifecycle::State& previous_sta
     m_joint_state_pos_handles.clear();
     this->release_interfaces();
     m_active = false;
+    m_standby_synchronized = false;
   }
   return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::SUCCESS;
 }
 
 
+void CartesianControllerBase::jointStateCallback(const sensor_msgs::msg::JointState::SharedPtr state)
+{
+  std::lock_guard<std::mutex> lock(m_standby_mutex);
+  if (m_active)
+  {
+    return;
+  }
+
+  for (size_t i = 0; i < m_joint_names.size(); ++i)
+  {
+    const auto name = std::find(state->name.begin(), state->name.end(), m_joint_names[i]);
+    const size_t j = name - state->name.begin();
+    if (name == state->name.end() || j >= state->position.size())
+    {
+      // Probably a different group of joints
+      return;
+    }
+    m_standby_positions(i) = state->position[j];
+    m_standby_velocities(i) = (j < state->velocity.size()) ? state->velocity[j] : 0.0;
+  }
+
+  // Only keep the latest state.  The solver belongs to the control cycle's
+  // thread and gets it on activation.
+  m_standby_stamp = get_node()->now();
+  m_standby_synchronized = true;
+}
+
+void CartesianControllerBase::runReloadThread()
+{
+  std::unique_lock<std::mutex> lock(m_reload_mutex);
+  while (!m_reload_stop)
+  {
+    m_reload_wakeup.wait_for(lock, MODEL_RELEASE_PERIOD, [this]() {
+      return m_reload_stop || !m_reload_description.empty();
+    });
+
+    // Release the previous model and solver once the control loop has swapped them out
+    if (m_model_swap_state == SWAP_DONE)
+    {
+      m_model_swap = ModelSwap();
+      m_model_swap_state = SWAP_IDLE;
+    }
+
+    if (m_reload_stop || m_reload_description.empty())
+    {
+      continue;
+    }
+    std::string robot_description;
+    robot_description.swap(m_reload_description);
+    lock.unlock();
+    reloadRobotModel(robot_description);
+    lock.lock();
+  }
+}
+
+void CartesianControllerBase::reloadRobotModel(const std::string& robot_description)
+{
+  // Take over the swap slot.  A new model that the control loop didn't pick
+  // up yet, e.g. while inactive, is replaced.
+  int state = m_model_swap_state.load();
+  while (state == SWAP_BUSY ||
+         (state == SWAP_READY && !m_model_swap_state.compare_exchange_weak(state, SWAP_IDLE)))
+  {
+    std::this_thread::yield();
+    state = m_model_swap_state.load();
+  }
+  m_model_swap = ModelSwap();
+  m_model_swap_state = SWAP_IDLE;
+
+  // The control loop only changes the current model in SWAP_BUSY
+  if (robot_description == m_robot_model->description)
+  {
+    return;
+  }
+
+  auto compatible = [](const KDL::Chain& a, const KDL::Chain& b)
+  {
+    if (a.getNrOfSegments() != b.getNrOfSegments())
+    {
+      return false;
+    }
+    for (unsigned int i = 0; i < a.getNrOfSegments(); ++i)
+    {
+      const auto& joint_a = a.getSegment(i).getJoint();
+      const auto& joint_b = b.getSegment(i).getJoint();
+      if (a.getSegment(i).getName() != b.getSegment(i).getName() ||
+          joint_a.getName() != joint_b.getName() || joint_a.getType() != joint_b.getType())
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  KDL::JntArray upper_pos_limits;
+  KDL::JntArray lower_pos_limits;
+  std::string error;
+  auto robot_model = loadRobotModel(robot_description, m_robot_base_link, m_end_effector_link, error);
+  if (!robot_model ||
+      !robot_model->jointLimits(m_joint_names, upper_pos_limits, lower_pos_limits, error))
+  {
+    RCLCPP_WARN(get_node()->get_logger(), "Keeping the current robot model: %s", error.c_str());
+    return;
+  }
+  if (!compatible(m_robot_model->chain, robot_model->chain))
+  {
+    RCLCPP_WARN(get_node()->get_logger(),
+                "Keeping the current robot model: The new chain from %s to %s has different "
+                "segments or joints. Reconfigure the controller for such changes.",
+                m_robot_base_link.c_str(),
+                m_end_effector_link.c_str());
+    return;
+  }
+
+  std::shared_ptr<IKSolver> ik_solver;
+  try
+  {
+    ik_solver = m_solver_loader->createSharedInstance(m_ik_solver_name);
+  }
+  catch (pluginlib::PluginlibException& ex)
+  {
+    RCLCPP_WARN(get_node()->get_logger(), "Keeping the current robot model: %s", ex.what());
+    return;
+  }
+  if (!ik_solver->init(get_node(), robot_model->chain, upper_pos_limits, lower_pos_limits))
+  {
+    RCLCPP_WARN(get_node()->get_logger(),
+                "Keeping the current robot model: Failed to initialize the IK solver %s",
+                m_ik_solver_name.c_str());
+    return;
+  }
+
+  m_model_swap.robot_model = robot_model;
+  m_model_swap.ik_solver = ik_solver;
+  m_model_swap_state = SWAP_READY;
+  RCLCPP_INFO(get_node()->get_logger(), "New robot model ready. Swapping it in at the next control cycle.");
+}
+
+bool CartesianControllerBase::applyToolFrame()
+{
+  if (!m_tool_frame_buffer.read())
+  {
+    return false;
+  }
+  m_tool_frame = m_tool_frame_buffer.latest().data;
+  m_ik_solver->core().setToolFrame(m_tool_frame.link, m_tool_frame.offset);
+  m_ik_solver->updateKinematics();
+  recordToolFrame();
+  m_flight_recorder.event(FlightRecorder::TOOL_SWITCH);
+  return true;
+}
+
+void CartesianControllerBase::recordToolFrame()
+{
+  if (m_flight_recorder.enabled())
+  {
+    m_flight_recorder.field(FlightRecorder::TOOL_LINK)[0] = m_tool_frame.link;
+    m_flight_recorder.set(FlightRecorder::TOOL_FRAME, m_tool_frame.offset);
+  }
+}
+
+void CartesianControllerBase::toolFrameCallback(const geometry_msgs::msg::PoseStamped::SharedPtr tool)
+{
+  auto& clock = *get_node()->get_clock();
+  if (std::isnan(tool->pose.position.x) || std::isnan(tool->pose.position.y) ||
+      std::isnan(tool->pose.position.z) || std::isnan(tool->pose.orientation.x) ||
+      std::isnan(tool->pose.orientation.y) || std::isnan(tool->pose.orientation.z) ||
+      std::isnan(tool->pose.orientation.w))
+  {
+    RCLCPP_WARN_STREAM_THROTTLE(get_node()->get_logger(),
+                                clock,
+                                3000,
+                                "NaN detected in tool frame. Ignoring input.");
+    return;
+  }
+
+  // Links of the chain, without its root
+  const std::string& link = tool->header.frame_id.empty() ? m_end_effector_link : tool->header.frame_id;
+  ToolFrame tool_frame;
+  for (size_t i = 0; i < m_robot_chain.segments.size(); ++i)
+  {
+    if (m_robot_chain.segments[i].getName() == link)
+    {
+      tool_frame.link = static_cast<int>(i + 1);
+      break;
+    }
+  }
+  if (tool_frame.link < 0)
+  {
+    RCLCPP_WARN_THROTTLE(get_node()->get_logger(),
+        clock, 3000,
+        "Got tool frame in unknown link %s. Expected a link between %s and %s.",
+        link.c_str(),
+        m_robot_base_link.c_str(),
+        m_end_effector_link.c_str());
+    return;
+  }
+
+  tool_frame.offset = KDL::Frame(
+    KDL::Rotation::Quaternion(
+      tool->pose.orientation.x,
+      tool->pose.orientation.y,
+      tool->pose.orientation.z,
+      tool->pose.orientation.w),
+    KDL::Vector(
+      tool->pose.position.x,
+      tool->pose.position.y,
+      tool->pose.position.z));
+  m_tool_frame_buffer.write(tool_frame, get_node()->now());
+  ++m_tool_frame_count;
+}
+
+void CartesianControllerBase::applyRobotModel()
+{
+  int state = SWAP_READY;
+  if (!m_model_swap_state.compare_exchange_strong(state, SWAP_BUSY))
+  {
+    return;
+  }
+
+  // Continue from the current joint state
+  m_model_swap.ik_solver->core().setStartState(m_ik_solver->core().getPositions(),
+                                               m_ik_solver->core().getVelocities());
+  m_model_swap.ik_solver->core().setToolFrame(m_tool_frame.link, m_tool_frame.offset);
+  m_model_swap.ik_solver->updateKinematics();
+
+  // Moves only.  The previous model and solver are released by the reload thread.
+  std::swap(m_ik_solver, m_model_swap.ik_solver);
+  std::swap(m_robot_model, m_model_swap.robot_model);
+  ++m_model_swap_count;
+  m_model_swap_state = SWAP_DONE;
+  m_flight_recorder.event(FlightRecorder::MODEL_SWAP);
+}
+
 void CartesianControllerBase::writeJointControlCmds()
 {
-  if (get_node()->get_parameter("solver.publish_state_feedback").as_bool())
+  CARTESIAN_CONTROLLERS_MEASURE_LATENCY(m_latencies[COMMAND_WRITE]);
+
+  if (m_solver_parameters.get().publish_state_feedback)
   {
     publishStateFeedback();
   }
@@ -399,11 +786,25 @@ void CartesianControllerBase::writeJointControlCmds()
     return false;
   };
 
+  // Remember solver outputs for the cycles in between
+  if (m_solver_cycle && m_decimation > 1)
+  {
+    m_extrapolator.push(m_simulated_joint_motion.positions, m_simulated_joint_motion.velocities);
+  }
+
+  if (m_flight_recorder.enabled())
+  {
+    recordFlightData();
+  }
+
   if (nan_in(m_simulated_joint_motion.positions) || nan_in(m_simulated_joint_motion.velocities))
   {
     RCLCPP_ERROR(get_node()->get_logger(),
                  "NaN detected in internal model. It's unlikely to recover from this. Shutting down.");
 
+    // Keep the history that led to this for post-mortem analysis
+    m_flight_recorder.flush();
+
 #if defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
     get_node()->shutdown();
 #elif defined CARTESIAN_CONTROLLERS_FOXY || defined CARTESIAN_CONTROLLERS_GALACTIC
@@ -430,107 +831,206 @@ void CartesianControllerBase::writeJointControlCmds()
       }
     }
   }
+
+  // Cycle boundary
+  applyRobotModel();
 }
 
 void CartesianControllerBase::computeJointControlCmds(const ctrl::Vector6D& error, const rclcpp::Duration& period)
 {
   // PD controlled system input
-  m_error_scale = get_node()->get_parameter("solver.error_scale").as_double();
-  m_cartesian_input = m_error_scale * m_spatial_controller(error,period);
+  m_cartesian_input = m_solver_parameters.get().error_scale * m_spatial_controller(error,period);
 
   // Simulate one step forward
-  m_simulated_joint_motion = m_ik_solver->getJointControlCmds(
-      period,
-      m_cartesian_input);
+  {
+    CARTESIAN_CONTROLLERS_MEASURE_LATENCY(m_latencies[SOLVER_STEP]);
+    m_ik_solver->getJointControlCmds(
+        period,
+        m_cartesian_input,
+        m_simulated_joint_motion);
+  }
 
+  CARTESIAN_CONTROLLERS_MEASURE_LATENCY(m_latencies[KINEMATICS_UPDATE]);
   m_ik_solver->updateKinematics();
 }
 
-ctrl::Vector6D CartesianControllerBase::displayInBaseLink(const ctrl::Vector6D& vector, const std::string& from)
+bool CartesianControllerBase::extrapolateJointControlCmds()
 {
-  // Adjust format
-  KDL::Wrench wrench_kdl;
-  for (int i = 0; i < 6; ++i)
+  const int step = m_decimation_counter;
+  m_decimation_counter = (m_decimation_counter + 1) % m_decimation;
+  m_solver_cycle = (step == 0);
+  if (m_solver_cycle)
   {
-    wrench_kdl(i) = vector[i];
+    m_solver_cycles.fetch_add(1, std::memory_order_relaxed);
+    return false;
   }
 
-  KDL::Frame transform_kdl;
-  m_forward_kinematics_solver->JntToCart(
-      m_ik_solver->getPositions(),
-      transform_kdl,
-      from);
-
-  // Rotate into new reference frame
-  wrench_kdl = transform_kdl.M * wrench_kdl;
+  m_extrapolator.extrapolate(m_solver_parameters.get().interpolation_order,
+                             static_cast<double>(step) / m_decimation,
+                             m_simulated_joint_motion.positions,
+                             m_simulated_joint_motion.velocities);
+  return true;
+}
 
-  // Reassign
-  ctrl::Vector6D out;
-  for (int i = 0; i < 6; ++i)
+void CartesianControllerBase::recordFlightData()
+{
+  double* positions = m_flight_recorder.field(FlightRecorder::JOINT_POSITIONS);
+  for (size_t i = 0; i < m_joint_state_pos_handles.size(); ++i)
+  {
+    positions[i] = m_joint_state_pos_handles[i].get().get_value();
+  }
+  m_flight_recorder.set(FlightRecorder::CARTESIAN_INPUT, m_cartesian_input);
+  m_flight_recorder.set(FlightRecorder::SIMULATED_POSITIONS, m_simulated_joint_motion.positions);
+  m_flight_recorder.set(FlightRecorder::SIMULATED_VELOCITIES, m_simulated_joint_motion.velocities);
+#ifdef CARTESIAN_CONTROLLERS_LATENCY_HISTOGRAMS
+  double* latencies = m_flight_recorder.field(FlightRecorder::STAGE_LATENCIES);
+  for (int i = 0; i < NUM_LATENCY_STAGES; ++i)
   {
-    out[i] = wrench_kdl(i);
+    latencies[i] = m_latencies[i].last();
   }
+#endif
+  m_flight_recorder.field(FlightRecorder::ITERATIONS)[0] =
+    m_solver_cycle ? m_last_iterations.load(std::memory_order_relaxed) : 0;
 
-  return out;
+  m_flight_recorder.commit(std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::system_clock::now().time_since_epoch()).count());
 }
 
-ctrl::Matrix6D CartesianControllerBase::displayInBaseLink(const ctrl::Matrix6D& tensor, const std::string& from)
+bool CartesianControllerBase::hasConverged(const ctrl::Vector6D& error)
 {
-  // Get rotation to base
-  KDL::Frame R_kdl;
-  m_forward_kinematics_solver->JntToCart(
-      m_ik_solver->getPositions(),
-      R_kdl,
-      from);
+  const SolverParameters& params = m_solver_parameters.get();
+  if (error.norm() < params.convergence_error_threshold)
+  {
+    return true;
+  }
 
-  // Adjust format
-  ctrl::Matrix3D R;
-  R <<
-      R_kdl.M.data[0],
-      R_kdl.M.data[1],
-      R_kdl.M.data[2],
-      R_kdl.M.data[3],
-      R_kdl.M.data[4],
-      R_kdl.M.data[5],
-      R_kdl.M.data[6],
-      R_kdl.M.data[7],
-      R_kdl.M.data[8];
+  double velocity_norm = 0.0;
+  for (const auto& velocity : m_simulated_joint_motion.velocities)
+  {
+    velocity_norm += velocity * velocity;
+  }
+  return std::sqrt(velocity_norm) < params.convergence_velocity_threshold;
+}
 
-  // Treat diagonal blocks as individual 2nd rank tensors.
-  // Display in base frame.
-  ctrl::Matrix6D tmp = ctrl::Matrix6D::Zero();
-  tmp.topLeftCorner<3,3>() = R * tensor.topLeftCorner<3,3>() * R.transpose();
-  tmp.bottomRightCorner<3,3>() = R * tensor.bottomRightCorner<3,3>() * R.transpose();
+std::chrono::steady_clock::duration CartesianControllerBase::timeBudget(const rclcpp::Duration& control_period)
+{
+  const double fraction = m_solver_parameters.get().time_budget;
+  return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+    std::chrono::nanoseconds(static_cast<int64_t>(fraction * control_period.nanoseconds())));
+}
+
+void CartesianControllerBase::recordIterations(int iterations,
+                                               bool converged,
+                                               bool degraded,
+                                               bool overrun,
+                                               std::chrono::steady_clock::duration elapsed)
+{
+  m_last_iterations.store(iterations, std::memory_order_relaxed);
+  if (iterations > m_max_iterations.load(std::memory_order_relaxed))
+  {
+    m_max_iterations.store(iterations, std::memory_order_relaxed);
+  }
+  m_cycles.fetch_add(1, std::memory_order_relaxed);
+  m_total_iterations.fetch_add(iterations, std::memory_order_relaxed);
+  if (converged)
+  {
+    m_converged_cycles.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (degraded)
+  {
+    m_degraded_cycles.fetch_add(1, std::memory_order_relaxed);
+  }
+  if (overrun)
+  {
+    m_budget_overruns.fetch_add(1, std::memory_order_relaxed);
+  }
 
-  return tmp;
+  const int64_t elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+  if (elapsed_ns > m_max_elapsed_ns.load(std::memory_order_relaxed))
+  {
+    m_max_elapsed_ns.store(elapsed_ns, std::memory_order_relaxed);
+  }
 }
 
-ctrl::Vector6D CartesianControllerBase::displayInTipLink(const ctrl::Vector6D& vector, const std::string& to)
+void CartesianControllerBase::produceSolverDiagnostics(diagnostic_updater::DiagnosticStatusWrapper& status)
 {
-  // Adjust format
-  KDL::Wrench wrench_kdl;
-  for (int i = 0; i < 6; ++i)
+  const uint64_t cycles = m_cycles.exchange(0, std::memory_order_relaxed);
+  const uint64_t total_iterations = m_total_iterations.exchange(0, std::memory_order_relaxed);
+  const uint64_t converged_cycles = m_converged_cycles.exchange(0, std::memory_order_relaxed);
+  const int max_iterations = m_max_iterations.exchange(0, std::memory_order_relaxed);
+  const int64_t max_elapsed_ns = m_max_elapsed_ns.exchange(0, std::memory_order_relaxed);
+  const uint64_t budget_overruns = m_budget_overruns.load(std::memory_order_relaxed);
+  const uint64_t solver_cycles = m_solver_cycles.exchange(0, std::memory_order_relaxed);
+
+  const auto now = std::chrono::steady_clock::now();
+  const double report_interval = std::chrono::duration<double>(now - m_last_solver_report).count();
+  m_last_solver_report = now;
+
+  if (budget_overruns > m_reported_budget_overruns)
   {
-    wrench_kdl(i) = vector[i];
+    status.summary(diagnostic_msgs::msg::DiagnosticStatus::WARN, "Solver exceeded its time budget");
   }
+  else
+  {
+    status.summary(diagnostic_msgs::msg::DiagnosticStatus::OK, "Solver running");
+  }
+  m_reported_budget_overruns = budget_overruns;
+  status.add("iteration limit", m_iterations);
+  status.add("iterations (last)", m_last_iterations.load(std::memory_order_relaxed));
+  status.add("iterations (max)", max_iterations);
+  status.add("iterations (mean)", cycles > 0 ? static_cast<double>(total_iterations) / cycles : 0.0);
+  status.add("cycles", cycles);
+  status.add("converged cycles", converged_cycles);
+  status.add("solver time (max) [us]", max_elapsed_ns / 1000.0);
+  status.add("time budget [fraction of period]", m_solver_parameters.getNonRT().time_budget);
+  status.add("degraded cycles (total)", m_degraded_cycles.load(std::memory_order_relaxed));
+  status.add("budget overruns (total)", budget_overruns);
+  status.add("decimation", m_decimation);
+  status.add("interpolation order", m_solver_parameters.getNonRT().interpolation_order);
+  status.add("solve rate [Hz]", report_interval > 0.0 ? solver_cycles / report_interval : 0.0);
+}
 
-  KDL::Frame transform_kdl;
-  m_forward_kinematics_solver->JntToCart(
-      m_ik_solver->getPositions(),
-      transform_kdl,
-      to);
+#ifdef CARTESIAN_CONTROLLERS_LATENCY_HISTOGRAMS
+void CartesianControllerBase::produceLatencyDiagnostics(diagnostic_updater::DiagnosticStatusWrapper& status)
+{
+  static const std::array<std::string, NUM_LATENCY_STAGES> names = {
+    "joint state sync", "error computation", "solver step", "kinematics update", "command write"};
 
-  // Rotate into new reference frame
-  wrench_kdl = transform_kdl.M.Inverse() * wrench_kdl;
+  status.summary(diagnostic_msgs::msg::DiagnosticStatus::OK, "Latencies in microseconds");
+  for (int i = 0; i < NUM_LATENCY_STAGES; ++i)
+  {
+    const LatencyHistogram::Summary summary = m_latencies[i].collect();
+    status.add(names[i] + " (count)", summary.count);
+    status.add(names[i] + " (p50)", summary.p50);
+    status.add(names[i] + " (p90)", summary.p90);
+    status.add(names[i] + " (p99)", summary.p99);
+    status.add(names[i] + " (max)", summary.max);
+  }
+}
+#endif
 
-  // Reassign
-  ctrl::Vector6D out;
-  for (int i = 0; i < 6; ++i)
+int CartesianControllerBase::linkIndex(const std::string& link)
+{
+  if (link == m_robot_base_link)
   {
-    out[i] = wrench_kdl(i);
+    return 0;
   }
+  return m_ik_solver->getKinematics().linkIndex(link);
+}
 
-  return out;
+ctrl::Vector6D CartesianControllerBase::displayInBaseLink(const ctrl::Vector6D& vector, int from)
+{
+  return core::rotate(m_ik_solver->getKinematics().getFrame(from).M, vector);
+}
+
+ctrl::Matrix6D CartesianControllerBase::displayInBaseLink(const ctrl::Matrix6D& tensor, int from)
+{
+  return core::rotate(m_ik_solver->getKinematics().getFrame(from).M, tensor);
+}
+
+ctrl::Vector6D CartesianControllerBase::displayInTipLink(const ctrl::Vector6D& vector, int to)
+{
+  return core::rotate(m_ik_solver->getKinematics().getFrame(to).M.Inverse(), vector);
 }
 
 void CartesianControllerBase::publishStateFeedback()
@@ -582,6 +1082,18 @@ void CartesianControllerBase::robot_description_callback(const std_msgs::msg::St
   {
     RCLCPP_ERROR_STREAM(get_node()->get_logger(), "Error in handling published robot URDF:" << e.what());
   }
+
+  // Parse updates in the background.  A description that is still pending
+  // is superseded.
+  if (!m_reload_robot_description || robot_description->data.empty())
+  {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(m_reload_mutex);
+    m_reload_description = robot_description->data;
+  }
+  m_reload_wakeup.notify_one();
 };
 
 } // namespace
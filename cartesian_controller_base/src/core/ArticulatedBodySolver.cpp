@@ -0,0 +1,246 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    ArticulatedBodySolver.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <cartesian_controller_base/core/ArticulatedBodySolver.h>
+
+namespace
+{
+  //! Cross product matrix of the given vector
+  ctrl::Matrix3D skew(const KDL::Vector& v)
+  {
+    ctrl::Matrix3D m;
+    m <<   0.0, -v.z(),  v.y(),
+         v.z(),    0.0, -v.x(),
+        -v.y(),  v.x(),    0.0;
+    return m;
+  }
+
+  ctrl::Vector3D toEigen(const KDL::Vector& v)
+  {
+    return ctrl::Vector3D(v.x(), v.y(), v.z());
+  }
+}
+
+
+namespace cartesian_controller_base{
+namespace core{
+
+  ArticulatedBodySolver::ArticulatedBodySolver()
+  {
+  }
+
+  ArticulatedBodySolver::~ArticulatedBodySolver(){}
+
+  void ArticulatedBodySolver::computeJointControlCmds(double period, const ctrl::Vector6D& net_force)
+  {
+    // Rebuild the generic model only if the user changed the link masses
+    const double link_mass = m_parameters.link_mass;
+    if (link_mass != m_model_link_mass)
+    {
+      buildGenericModel(link_mass);
+    }
+
+    // Compute joint accelerations according to: \f$ \ddot{q} = H^{-1} ( J^T f) \f$
+    computeJointAccelerations(net_force);
+
+    // Numerical time integration with the Euler forward method
+    m_current_positions.data = m_last_positions.data + m_last_velocities.data * period;
+    m_current_velocities.data = m_last_velocities.data + m_current_accelerations.data * period;
+    m_current_velocities.data *= 0.9;  // 10 % global damping against unwanted null space motion.
+                                       // Will cause exponential slow-down without input.
+    // Make sure positions stay in allowed margins
+    applyJointLimits();
+
+    // Update for the next cycle
+    m_last_positions = m_current_positions;
+    m_last_velocities = m_current_velocities;
+  }
+
+  void ArticulatedBodySolver::computeJointAccelerations(const ctrl::Vector6D& net_force)
+  {
+    m_kinematics.update(m_current_positions);
+
+    // Rigid-body inertias about the base origin, accumulated per moving body.
+    // The generic masses sit in the tips of their segments.
+    for (int j = 0; j < m_number_joints; ++j)
+    {
+      m_articulated_inertia[j].setZero();
+      m_bias_force[j].setZero();
+    }
+    for (size_t s = 0; s < m_segment_body.size(); ++s)
+    {
+      const int body = m_segment_body[s];
+      const double m = m_segment_mass[s];
+      if (body < 0 || m == 0.0)
+      {
+        continue;
+      }
+      const ctrl::Matrix3D c = skew(m_kinematics.getFrame(s + 1).p);
+      ctrl::Matrix6D& I = m_articulated_inertia[body];
+      I.topLeftCorner<3,3>().diagonal().array() += m;
+      I.topRightCorner<3,3>().noalias() += m * c.transpose();
+      I.bottomLeftCorner<3,3>().noalias() += m * c;
+      I.bottomRightCorner<3,3>().noalias() += m * c * c.transpose();
+      I.bottomRightCorner<3,3>().diagonal().array() += m_segment_inertia[s];
+    }
+
+    // Motion subspaces of the joints with their reference point in the base
+    // origin.  Unlike the Jacobian, these include the joints behind the TCP.
+    for (int j = 0; j < m_number_joints; ++j)
+    {
+      ctrl::Vector6D& S = m_motion_subspace[j];
+      const ctrl::Vector3D z = toEigen(m_kinematics.getJointAxis(j));
+      if (m_joint_prismatic[j])
+      {
+        S.head<3>() = z;
+        S.tail<3>().setZero();
+      }
+      else
+      {
+        S.head<3>() = toEigen(m_kinematics.getJointOrigin(j)).cross(z);
+        S.tail<3>() = z;
+      }
+    }
+
+    // The net force acts on the TCP. Shift it to the base origin and apply
+    // it to the TCP's body.
+    const int tool = m_kinematics.getToolIndex();
+    const int tool_body = tool > 0 ? m_segment_body[tool - 1] : -1;
+    if (tool_body >= 0)
+    {
+      const ctrl::Vector3D p_ee = toEigen(m_kinematics.getTipFrame().p);
+      ctrl::Vector6D& p_tool = m_bias_force[tool_body];
+      p_tool.head<3>() = -net_force.head<3>();
+      p_tool.tail<3>() = -(net_force.tail<3>() + p_ee.cross(net_force.head<3>()));
+    }
+
+    // Backward pass: articulated-body inertias and bias forces
+    for (int j = m_number_joints - 1; j >= 0; --j)
+    {
+      const ctrl::Vector6D& S = m_motion_subspace[j];
+      m_U[j].noalias() = m_articulated_inertia[j] * S;
+      m_D[j] = S.dot(m_U[j]);
+      m_u[j] = -S.dot(m_bias_force[j]);
+
+      if (j > 0)
+      {
+        m_articulated_inertia[j - 1].noalias() +=
+          m_articulated_inertia[j] - m_U[j] * m_U[j].transpose() / m_D[j];
+        m_bias_force[j - 1].noalias() += m_bias_force[j] + m_U[j] * (m_u[j] / m_D[j]);
+      }
+    }
+
+    // Forward pass: joint accelerations, starting from the resting base
+    ctrl::Vector6D a = ctrl::Vector6D::Zero();
+    for (int j = 0; j < m_number_joints; ++j)
+    {
+      m_current_accelerations(j) = (m_u[j] - m_U[j].dot(a)) / m_D[j];
+      a.noalias() += m_motion_subspace[j] * m_current_accelerations(j);
+    }
+  }
+
+  bool ArticulatedBodySolver::init(const KDL::Chain& chain,
+                                   const KDL::JntArray& upper_pos_limits,
+                                   const KDL::JntArray& lower_pos_limits)
+  {
+    IKSolver::init(chain, upper_pos_limits, lower_pos_limits);
+
+    if (m_number_joints == 0)
+    {
+      return false;
+    }
+
+    // Assign fixed segments to the preceding moving body
+    const size_t nr_segments = m_chain.getNrOfSegments();
+    m_segment_mass.assign(nr_segments, 0.0);
+    m_segment_inertia.assign(nr_segments, 0.0);
+    m_segment_body.assign(nr_segments, -1);
+    m_joint_prismatic.clear();
+    int body = -1;
+    for (size_t s = 0; s < nr_segments; ++s)
+    {
+      const KDL::Joint::JointType type = m_chain.getSegment(s).getJoint().getType();
+      if (type != KDL::Joint::None)
+      {
+        ++body;
+        m_joint_prismatic.push_back(type == KDL::Joint::TransAxis || type == KDL::Joint::TransX ||
+                                    type == KDL::Joint::TransY || type == KDL::Joint::TransZ);
+      }
+      m_segment_body[s] = body;
+    }
+    buildGenericModel(m_parameters.link_mass);
+
+    m_articulated_inertia.resize(m_number_joints);
+    m_bias_force.resize(m_number_joints);
+    m_motion_subspace.resize(m_number_joints);
+    m_U.resize(m_number_joints);
+    m_D = ctrl::VectorND::Zero(m_number_joints);
+    m_u = ctrl::VectorND::Zero(m_number_joints);
+
+    return true;
+  }
+
+  void ArticulatedBodySolver::buildGenericModel(double link_mass)
+  {
+    // Set all masses and inertias to minimal (yet stable) values.
+    double ip_min = 0.000001;
+    for (size_t s = 0; s < m_segment_mass.size(); ++s)
+    {
+      // Fixed joint segment
+      if (m_chain.getSegment(s).getJoint().getType() == KDL::Joint::None)
+      {
+        m_segment_mass[s] = 0.0;
+        m_segment_inertia[s] = 0.0;
+      }
+      else  // relatively moving segment
+      {
+        m_segment_mass[s] = link_mass;
+        m_segment_inertia[s] = ip_min;
+      }
+    }
+
+    // Only give the last segment a generic mass and inertia.
+    // See https://arxiv.org/pdf/1908.06252.pdf for a motivation for this setting.
+    m_segment_mass.back() = 1;
+    m_segment_inertia.back() = 1;
+
+    m_model_link_mass = link_mass;
+  }
+
+} // namespace core
+} // namespace cartesian_controller_base
@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    CartesianMath.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cartesian_controller_base/core/CartesianMath.h>
+
+namespace cartesian_controller_base
+{
+namespace core
+{
+
+ctrl::Vector6D computeMotionError(const KDL::Frame& target, const KDL::Frame& current)
+{
+  // Transformation from target -> current corresponds to error = target - current
+  KDL::Frame error_kdl;
+  error_kdl.M = target.M * current.M.Inverse();
+  error_kdl.p = target.p - current.p;
+
+  // Use Rodrigues Vector for a compact representation of orientation errors
+  // Only for angles within [0,Pi)
+  KDL::Vector rot_axis = KDL::Vector::Zero();
+  double angle    = error_kdl.M.GetRotAngle(rot_axis);   // rot_axis is normalized
+  double distance = error_kdl.p.Normalize();
+
+  // Clamp maximal tolerated error.
+  // The remaining error will be handled in the next control cycle.
+  // Note that this is also the maximal offset that the
+  // cartesian_compliance_controller can use to build up a restoring stiffness
+  // wrench.
+  const double max_angle = 1.0;
+  const double max_distance = 1.0;
+  angle    = std::clamp(angle,-max_angle,max_angle);
+  distance = std::clamp(distance,-max_distance,max_distance);
+
+  // Scale errors to allowed magnitudes
+  rot_axis = rot_axis * angle;
+  error_kdl.p = error_kdl.p * distance;
+
+  // Reassign values
+  ctrl::Vector6D error;
+  error(0) = error_kdl.p.x();
+  error(1) = error_kdl.p.y();
+  error(2) = error_kdl.p.z();
+  error(3) = rot_axis(0);
+  error(4) = rot_axis(1);
+  error(5) = rot_axis(2);
+
+  return error;
+}
+
+ctrl::Vector6D rotate(const KDL::Rotation& rotation, const ctrl::Vector6D& vector)
+{
+  // Adjust format
+  KDL::Wrench wrench_kdl;
+  for (int i = 0; i < 6; ++i)
+  {
+    wrench_kdl(i) = vector[i];
+  }
+
+  // Rotate into new reference frame
+  wrench_kdl = rotation * wrench_kdl;
+
+  // Reassign
+  ctrl::Vector6D out;
+  for (int i = 0; i < 6; ++i)
+  {
+    out[i] = wrench_kdl(i);
+  }
+
+  return out;
+}
+
+ctrl::Matrix6D rotate(const KDL::Rotation& rotation, const ctrl::Matrix6D& tensor)
+{
+  // Adjust format
+  ctrl::Matrix3D R;
+  R <<
+      rotation.data[0],
+      rotation.data[1],
+      rotation.data[2],
+      rotation.data[3],
+      rotation.data[4],
+      rotation.data[5],
+      rotation.data[6],
+      rotation.data[7],
+      rotation.data[8];
+
+  // Treat diagonal blocks as individual 2nd rank tensors.
+  ctrl::Matrix6D tmp = ctrl::Matrix6D::Zero();
+  tmp.topLeftCorner<3,3>() = R * tensor.topLeftCorner<3,3>() * R.transpose();
+  tmp.bottomRightCorner<3,3>() = R * tensor.bottomRightCorner<3,3>() * R.transpose();
+
+  return tmp;
+}
+
+ctrl::Vector6D computeForceError(const ForceErrorParameters& parameters,
+                                 const ctrl::Vector6D& target_wrench,
+                                 const ctrl::Vector6D& ft_sensor_wrench,
+                                 const KDL::Rotation& end_effector_rotation,
+                                 const KDL::Rotation& ft_sensor_rotation)
+{
+  ctrl::Vector6D target = target_wrench;
+
+  if (parameters.hand_frame_control) // Assume end-effector frame by convention
+  {
+    target = rotate(end_effector_rotation, target_wrench);
+  }
+
+  // Superimpose target wrench and sensor wrench in base frame
+  return rotate(ft_sensor_rotation, ft_sensor_wrench) + target;
+}
+
+ctrl::Vector6D computeComplianceError(const ComplianceErrorParameters& parameters,
+                                      const ctrl::Vector6D& motion_error,
+                                      const ctrl::Vector6D& force_error,
+                                      const KDL::Rotation& compliance_ref_rotation)
+{
+  const ctrl::Matrix6D stiffness = parameters.stiffness.asDiagonal();
+
+  return
+    // Spring force in base orientation
+    rotate(compliance_ref_rotation, stiffness) * motion_error
+
+    // Sensor and target force in base orientation
+    + force_error;
+}
+
+} // namespace core
+} // namespace cartesian_controller_base
@@ -0,0 +1,251 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    CartesianSpline.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <cartesian_controller_base/core/CartesianSpline.h>
+#include <cmath>
+
+namespace
+{
+
+// Logarithm of a unit quaternion as rotation vector / 2
+Eigen::Vector3d log(const Eigen::Quaterniond& q)
+{
+  const double norm = q.vec().norm();
+  if (norm < 1e-12)
+  {
+    return Eigen::Vector3d::Zero();
+  }
+  return q.vec() * std::atan2(norm, q.w()) / norm;
+}
+
+// Inverse of log()
+Eigen::Quaterniond exp(const Eigen::Vector3d& v)
+{
+  const double angle = v.norm();
+  if (angle < 1e-12)
+  {
+    return Eigen::Quaterniond::Identity();
+  }
+  const Eigen::Vector3d axis = v / angle;
+  return Eigen::Quaterniond(std::cos(angle),
+                            std::sin(angle) * axis.x(),
+                            std::sin(angle) * axis.y(),
+                            std::sin(angle) * axis.z());
+}
+
+} // namespace
+
+namespace cartesian_controller_base
+{
+namespace core
+{
+
+CartesianSpline::CartesianSpline()
+{
+}
+
+bool CartesianSpline::init(const std::vector<Waypoint>& waypoints, std::string& error)
+{
+  if (waypoints.empty())
+  {
+    error = "Trajectory has no waypoints";
+    return false;
+  }
+
+  // Start at time zero from where the robot is, see setStart()
+  m_implicit_start = waypoints.front().time > 0.0;
+  const size_t offset = m_implicit_start ? 1 : 0;
+  const size_t n = waypoints.size() + offset;
+  m_times.resize(n);
+  m_positions.resize(n);
+  m_orientations.resize(n);
+  for (size_t i = 0; i < waypoints.size(); ++i)
+  {
+    const Waypoint& waypoint = waypoints[i];
+    if (!std::isfinite(waypoint.time) || (i > 0 && waypoint.time <= waypoints[i - 1].time))
+    {
+      error = "Waypoint " + std::to_string(i) + " is not strictly later than its predecessor";
+      return false;
+    }
+
+    const size_t j = i + offset;
+    m_times[j] = waypoint.time;
+    m_positions[j] = Eigen::Vector3d(waypoint.pose.p.x(), waypoint.pose.p.y(), waypoint.pose.p.z());
+    double x, y, z, w;
+    waypoint.pose.M.GetQuaternion(x, y, z, w);
+    m_orientations[j] = Eigen::Quaterniond(w, x, y, z);
+    if (!m_positions[j].allFinite() || !m_orientations[j].coeffs().allFinite())
+    {
+      error = "Waypoint " + std::to_string(i) + " is not finite";
+      return false;
+    }
+    m_orientations[j].normalize();
+
+    // Take the short way between consecutive orientations
+    if (i > 0 && m_orientations[j].dot(m_orientations[j - 1]) < 0.0)
+    {
+      m_orientations[j].coeffs() = -m_orientations[j].coeffs();
+    }
+  }
+  if (m_implicit_start)
+  {
+    m_times[0] = 0.0;
+    m_positions[0] = m_positions[1];
+    m_orientations[0] = m_orientations[1];
+  }
+
+  // Hermite tangents and SQUAD control points
+  m_tangents.assign(n, Eigen::Vector3d::Zero());
+  m_controls = m_orientations;
+  for (size_t i = 1; i + 1 < n; ++i)
+  {
+    computeTangent(i);
+  }
+
+  m_segments.resize(n - 1);
+  for (size_t i = 0; i + 1 < n; ++i)
+  {
+    computeSegment(i);
+  }
+
+  m_first = waypoints.front().pose;
+  m_last = waypoints.back().pose;
+  m_start_time = m_times.front();
+  m_end_time = m_times.back();
+  return true;
+}
+
+void CartesianSpline::setStart(const KDL::Frame& pose)
+{
+  if (!m_implicit_start)
+  {
+    return;
+  }
+
+  m_positions[0] = Eigen::Vector3d(pose.p.x(), pose.p.y(), pose.p.z());
+  double x, y, z, w;
+  pose.M.GetQuaternion(x, y, z, w);
+  m_orientations[0] = Eigen::Quaterniond(w, x, y, z);
+  m_orientations[0].normalize();
+  if (m_orientations[0].dot(m_orientations[1]) < 0.0)
+  {
+    m_orientations[0].coeffs() = -m_orientations[0].coeffs();
+  }
+  m_controls[0] = m_orientations[0];
+
+  // Only the neighbors of the start depend on it
+  if (m_times.size() > 2)
+  {
+    computeTangent(1);
+    computeSegment(1);
+  }
+  computeSegment(0);
+  m_first = pose;
+}
+
+void CartesianSpline::computeTangent(size_t i)
+{
+  const double before = m_times[i] - m_times[i - 1];
+  const double after = m_times[i + 1] - m_times[i];
+  m_tangents[i] = 0.5 * ((m_positions[i + 1] - m_positions[i]) / after +
+                         (m_positions[i] - m_positions[i - 1]) / before);
+
+  // The usual SQUAD control point -(log(q_i^-1 q_i+1) + log(q_i^-1 q_i-1)) / 4,
+  // weighted with the segment durations so that the angular velocity doesn't
+  // jump between segments of different length.
+  const Eigen::Quaterniond inverse = m_orientations[i].conjugate();
+  m_controls[i] = m_orientations[i] * exp(-0.5 * (before * log(inverse * m_orientations[i + 1]) +
+                                                  after * log(inverse * m_orientations[i - 1])) /
+                                          (before + after));
+}
+
+void CartesianSpline::computeSegment(size_t i)
+{
+  Segment& segment = m_segments[i];
+  segment.start = m_times[i];
+  segment.duration = m_times[i + 1] - m_times[i];
+
+  const Eigen::Vector3d& p0 = m_positions[i];
+  const Eigen::Vector3d& p1 = m_positions[i + 1];
+  const Eigen::Vector3d m0 = segment.duration * m_tangents[i];
+  const Eigen::Vector3d m1 = segment.duration * m_tangents[i + 1];
+  segment.c0 = p0;
+  segment.c1 = m0;
+  segment.c2 = -3.0 * p0 - 2.0 * m0 + 3.0 * p1 - m1;
+  segment.c3 = 2.0 * p0 + m0 - 2.0 * p1 + m1;
+
+  segment.q0 = m_orientations[i];
+  segment.q1 = m_orientations[i + 1];
+  segment.a0 = m_controls[i];
+  segment.a1 = m_controls[i + 1];
+}
+
+KDL::Frame CartesianSpline::evaluate(double time, size_t& segment) const
+{
+  if (m_segments.empty() || time <= m_start_time)
+  {
+    segment = 0;
+    return m_first;
+  }
+  if (time >= m_end_time)
+  {
+    segment = m_segments.size() - 1;
+    return m_last;
+  }
+
+  // Time usually advances in small steps
+  if (segment >= m_segments.size() || m_segments[segment].start > time)
+  {
+    segment = 0;
+  }
+  while (segment + 1 < m_segments.size() && m_segments[segment + 1].start <= time)
+  {
+    ++segment;
+  }
+
+  const Segment& current = m_segments[segment];
+  const double s = (time - current.start) / current.duration;
+  const Eigen::Vector3d p = current.c0 + s * (current.c1 + s * (current.c2 + s * current.c3));
+  const Eigen::Quaterniond q =
+    current.q0.slerp(s, current.q1).slerp(2.0 * s * (1.0 - s), current.a0.slerp(s, current.a1));
+
+  return KDL::Frame(KDL::Rotation::Quaternion(q.x(), q.y(), q.z(), q.w()), KDL::Vector(p.x(), p.y(), p.z()));
+}
+
+} // namespace core
+} // namespace cartesian_controller_base
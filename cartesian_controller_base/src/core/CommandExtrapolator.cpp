@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    CommandExtrapolator.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cartesian_controller_base/core/CommandExtrapolator.h>
+#include <cmath>
+
+namespace cartesian_controller_base
+{
+namespace core
+{
+
+CommandExtrapolator::CommandExtrapolator()
+{
+}
+
+void CommandExtrapolator::init(const KDL::JntArray& upper_pos_limits, const KDL::JntArray& lower_pos_limits)
+{
+  m_upper_pos_limits = upper_pos_limits;
+  m_lower_pos_limits = lower_pos_limits;
+  for (int i = 0; i <= MAX_ORDER; ++i)
+  {
+    m_positions[i].assign(upper_pos_limits.rows(), 0.0);
+    m_velocities[i].assign(upper_pos_limits.rows(), 0.0);
+  }
+}
+
+void CommandExtrapolator::reset(const std::vector<double>& positions, const std::vector<double>& velocities)
+{
+  for (int i = 0; i <= MAX_ORDER; ++i)
+  {
+    std::copy(positions.begin(), positions.end(), m_positions[i].begin());
+    std::fill(m_velocities[i].begin(), m_velocities[i].end(), 0.0);
+  }
+  std::copy(velocities.begin(), velocities.end(), m_velocities[0].begin());
+}
+
+void CommandExtrapolator::push(const std::vector<double>& positions, const std::vector<double>& velocities)
+{
+  // Recycle the oldest buffers for the newest output
+  for (int i = MAX_ORDER; i > 0; --i)
+  {
+    m_positions[i].swap(m_positions[i - 1]);
+    m_velocities[i].swap(m_velocities[i - 1]);
+  }
+  std::copy(positions.begin(), positions.end(), m_positions[0].begin());
+  std::copy(velocities.begin(), velocities.end(), m_velocities[0].begin());
+}
+
+void CommandExtrapolator::extrapolate(int order,
+                                      double time,
+                                      std::vector<double>& positions,
+                                      std::vector<double>& velocities) const
+{
+  extrapolate(m_positions, order, time, positions);
+  extrapolate(m_velocities, order, time, velocities);
+
+  for (size_t i = 0; i < positions.size(); ++i)
+  {
+    if (std::isnan(m_lower_pos_limits(i)) || std::isnan(m_upper_pos_limits(i)))
+    {
+      // Joint marked as continuous.
+      continue;
+    }
+    positions[i] = std::clamp(positions[i], m_lower_pos_limits(i), m_upper_pos_limits(i));
+  }
+}
+
+void CommandExtrapolator::extrapolate(const std::array<std::vector<double>, MAX_ORDER + 1>& history,
+                                      int order,
+                                      double time,
+                                      std::vector<double>& out)
+{
+  // Newton form of the polynomial through the outputs at times 0, -1, -2
+  const std::vector<double>& x0 = history[0];
+  const std::vector<double>& x1 = history[1];
+  const std::vector<double>& x2 = history[2];
+  out.resize(x0.size());
+  for (size_t i = 0; i < x0.size(); ++i)
+  {
+    double x = x0[i];
+    if (order >= 1)
+    {
+      x += time * (x0[i] - x1[i]);
+    }
+    if (order >= 2)
+    {
+      x += 0.5 * time * (time + 1.0) * (x0[i] - 2.0 * x1[i] + x2[i]);
+    }
+    out[i] = x;
+  }
+}
+
+} // namespace core
+} // namespace cartesian_controller_base
@@ -0,0 +1,113 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    DampedLeastSquaresSolver.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2020/03/27
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <cartesian_controller_base/core/DampedLeastSquaresSolver.h>
+
+namespace cartesian_controller_base{
+namespace core{
+
+  DampedLeastSquaresSolver::DampedLeastSquaresSolver()
+  {
+  }
+
+  DampedLeastSquaresSolver::~DampedLeastSquaresSolver(){}
+
+  void DampedLeastSquaresSolver::computeJointControlCmds(double period, const ctrl::Vector6D& net_force)
+  {
+    // Compute joint velocities with the implementation for this chain's size
+    (this->*m_compute_joint_velocities)(net_force, m_parameters.alpha);
+
+    // Integrate once, starting with zero motion
+    m_current_positions.data = m_last_positions.data + 0.5 * m_current_velocities.data * period;
+
+    // Make sure positions stay in allowed margins
+    applyJointLimits();
+
+    // Update for the next cycle
+    m_last_positions = m_current_positions;
+  }
+
+  template <int Dof>
+  void DampedLeastSquaresSolver::computeJointVelocities(const ctrl::Vector6D& net_force, double alpha)
+  {
+    // Get the joint Jacobian from the shared kinematics
+    const KDL::Jacobian& jacobian = getKinematics().getJacobian();
+    const Eigen::Map<const Eigen::Matrix<double, 6, Dof> > J(jacobian.data.data(), 6, m_number_joints);
+    Eigen::Map<Eigen::Matrix<double, Dof, 1> > q_dot(m_current_velocities.data.data(), m_number_joints);
+
+    if constexpr (Dof == Eigen::Dynamic)
+    {
+      if (m_number_joints < 6)
+      {
+        // Compute joint velocities according to:
+        // \f$ \dot{q} = ( J^T J + \alpha^2 I )^{-1} J^T f \f$
+        m_jnt_space_matrix.noalias() = J.transpose() * J;
+        m_jnt_space_matrix.diagonal().array() += alpha * alpha;
+        m_jnt_space_decomposition.compute(m_jnt_space_matrix);
+        q_dot.noalias() = J.transpose() * net_force;
+        m_jnt_space_decomposition.solveInPlace(q_dot);
+        return;
+      }
+    }
+
+    // Compute joint velocities according to:
+    // \f$ \dot{q} = J^T ( J J^T + \alpha^2 I )^{-1} f \f$
+    m_task_space_matrix.noalias() = J * J.transpose();
+    m_task_space_matrix.diagonal().array() += alpha * alpha;
+    m_task_space_decomposition.compute(m_task_space_matrix);
+    m_task_space_force = m_task_space_decomposition.solve(net_force);
+    q_dot.noalias() = J.transpose() * m_task_space_force;
+  }
+
+  bool DampedLeastSquaresSolver::init(const KDL::Chain& chain,
+                                      const KDL::JntArray& upper_pos_limits,
+                                      const KDL::JntArray& lower_pos_limits)
+  {
+    IKSolver::init(chain, upper_pos_limits, lower_pos_limits);
+
+    m_jnt_space_matrix.resize(m_number_joints, m_number_joints);
+    m_jnt_space_decomposition = Eigen::LLT<ctrl::MatrixND>(m_number_joints);
+    m_compute_joint_velocities = dispatchJointCount(m_number_joints, [](auto N) {
+      return &DampedLeastSquaresSolver::computeJointVelocities<decltype(N)::value>;
+    });
+
+    return true;
+  }
+
+} // namespace core
+} // namespace cartesian_controller_base
@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    ForwardDynamicsSolver.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2020/03/24
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <cartesian_controller_base/core/ForwardDynamicsSolver.h>
+
+namespace cartesian_controller_base{
+namespace core{
+
+  ForwardDynamicsSolver::ForwardDynamicsSolver()
+  {
+  }
+
+  ForwardDynamicsSolver::~ForwardDynamicsSolver(){}
+
+  void ForwardDynamicsSolver::computeJointControlCmds(double period, const ctrl::Vector6D& net_force)
+  {
+
+    // Rebuild the generic model only if the user changed the link masses
+    const double link_mass = m_parameters.link_mass;
+    if (link_mass != m_model_link_mass)
+    {
+      buildGenericModel(link_mass);
+    }
+
+    // Compute joint space inertia matrix
+    m_jnt_space_inertia_solver->JntToMass(m_current_positions,m_jnt_space_inertia);
+
+    // Compute joint accelerations with the implementation for this chain's size
+    (this->*m_compute_joint_accelerations)(net_force);
+
+    // Numerical time integration with the Euler forward method
+    m_current_positions.data = m_last_positions.data + m_last_velocities.data * period;
+    m_current_velocities.data = m_last_velocities.data + m_current_accelerations.data * period;
+    m_current_velocities.data *= 0.9;  // 10 % global damping against unwanted null space motion.
+                                       // Will cause exponential slow-down without input.
+    // Make sure positions stay in allowed margins
+    applyJointLimits();
+
+    // Update for the next cycle
+    m_last_positions = m_current_positions;
+    m_last_velocities = m_current_velocities;
+  }
+
+  template <int Dof>
+  void ForwardDynamicsSolver::computeJointAccelerations(const ctrl::Vector6D& net_force)
+  {
+    // Get the joint Jacobian from the shared kinematics
+    const KDL::Jacobian& jacobian = getKinematics().getJacobian();
+    const Eigen::Map<const Eigen::Matrix<double, 6, Dof> > J(jacobian.data.data(), 6, m_number_joints);
+    const Eigen::Map<const Eigen::Matrix<double, Dof, Dof> > H(
+      m_jnt_space_inertia.data.data(), m_number_joints, m_number_joints);
+    Eigen::Map<Eigen::Matrix<double, Dof, 1> > q_ddot(m_current_accelerations.data.data(), m_number_joints);
+
+    // Compute joint accelerations according to: \f$ \ddot{q} = H^{-1} ( J^T f) \f$
+    // H is symmetric positive definite. Solve in-place with its LDLT
+    // decomposition instead of inverting it.
+    q_ddot.noalias() = J.transpose() * net_force;
+    if constexpr (Dof == Eigen::Dynamic)
+    {
+      m_jnt_space_inertia_decomposition.compute(H);
+      m_jnt_space_inertia_decomposition.solveInPlace(q_ddot);
+    }
+    else
+    {
+      Eigen::LDLT<Eigen::Matrix<double, Dof, Dof> > decomposition(H);
+      decomposition.solveInPlace(q_ddot);
+    }
+  }
+
+  bool ForwardDynamicsSolver::init(const KDL::Chain& chain,
+                                   const KDL::JntArray& upper_pos_limits,
+                                   const KDL::JntArray& lower_pos_limits)
+  {
+    IKSolver::init(chain, upper_pos_limits, lower_pos_limits);
+
+    // The dynamics solver only needs to traverse the moving segments
+    m_model_segments = collapseFixedSegments(m_chain, m_model_chain);
+
+    if (!buildGenericModel(m_parameters.link_mass))
+    {
+      return false;
+    }
+
+    // Forward dynamics
+    m_jnt_space_inertia_solver.reset(new KDL::ChainDynParam(m_model_chain,KDL::Vector::Zero()));
+    m_jnt_space_inertia.resize(m_number_joints);
+    m_jnt_space_inertia_decomposition = Eigen::LDLT<ctrl::MatrixND>(m_number_joints);
+    m_compute_joint_accelerations = dispatchJointCount(m_number_joints, [](auto N) {
+      return &ForwardDynamicsSolver::computeJointAccelerations<decltype(N)::value>;
+    });
+
+    return true;
+  }
+
+  bool ForwardDynamicsSolver::buildGenericModel(double link_mass)
+  {
+    // Set all masses and inertias to minimal (yet stable) values.
+    double ip_min = 0.000001;
+    for (auto& segment : m_model_chain.segments)
+    {
+      segment.setInertia(KDL::RigidBodyInertia::Zero());
+    }
+    for (size_t i = 0; i < m_chain.segments.size(); ++i)
+    {
+      KDL::RigidBodyInertia inertia = KDL::RigidBodyInertia::Zero();
+
+      // Only give the last segment a generic mass and inertia.
+      // See https://arxiv.org/pdf/1908.06252.pdf for a motivation for this setting.
+      if (i == m_chain.segments.size() - 1)
+      {
+        double m = 1;
+        double ip = 1;
+        inertia = KDL::RigidBodyInertia(
+            m,
+            KDL::Vector::Zero(),
+            KDL::RotationalInertia(ip, ip, ip));
+      }
+      else if (m_chain.segments[i].getJoint().getType() != KDL::Joint::None)  // relatively moving segment
+      {
+        inertia = KDL::RigidBodyInertia(
+            link_mass,            // mass
+            KDL::Vector::Zero(),  // center of gravity
+            KDL::RotationalInertia(
+              ip_min,             // ixx
+              ip_min,             // iyy
+              ip_min              // izz
+              // ixy, ixy, iyz default to 0.0
+              ));
+      }
+      // Fixed joint segments stay without inertia
+
+      // Move it into the merged segment of the model
+      KDL::Segment& target = m_model_chain.segments[m_model_segments[i].segment];
+      target.setInertia(target.getInertia() + m_model_segments[i].offset * inertia);
+    }
+
+    m_model_link_mass = link_mass;
+    ++m_model_build_count;
+    return true;
+  }
+
+
+} // namespace core
+} // namespace cartesian_controller_base
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    IKSolver.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2016/02/14
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cartesian_controller_base/core/IKSolver.h>
+#include <cmath>
+
+namespace cartesian_controller_base{
+namespace core{
+
+  IKSolver::IKSolver()
+  {
+  }
+
+  IKSolver::~IKSolver(){}
+
+  bool IKSolver::init(const KDL::Chain& chain,
+                      const KDL::JntArray& upper_pos_limits,
+                      const KDL::JntArray& lower_pos_limits)
+  {
+    // Initialize
+    m_chain = chain;
+    m_number_joints              = m_chain.getNrOfJoints();
+    m_current_positions.data     = ctrl::VectorND::Zero(m_number_joints);
+    m_current_velocities.data    = ctrl::VectorND::Zero(m_number_joints);
+    m_current_accelerations.data = ctrl::VectorND::Zero(m_number_joints);
+    m_last_positions.data        = ctrl::VectorND::Zero(m_number_joints);
+    m_last_velocities.data       = ctrl::VectorND::Zero(m_number_joints);
+    m_upper_pos_limits           = upper_pos_limits;
+    m_lower_pos_limits           = lower_pos_limits;
+
+    // Forward kinematics
+    m_kinematics.init(m_chain);
+
+    return true;
+  }
+
+  const KinematicsCache& IKSolver::getKinematics()
+  {
+    m_kinematics.update(m_current_positions);
+    return m_kinematics;
+  }
+
+  void IKSolver::setStartState(const KDL::JntArray& positions)
+  {
+    for (int i = 0; i < m_number_joints; ++i)
+    {
+      m_current_positions(i)     = positions(i);
+      m_current_velocities(i)    = 0.0;
+      m_current_accelerations(i) = 0.0;
+      m_last_positions(i)        = m_current_positions(i);
+      m_last_velocities(i)       = m_current_velocities(i);
+    }
+  }
+
+  void IKSolver::setStartState(const KDL::JntArray& positions, const KDL::JntArray& velocities)
+  {
+    setStartState(positions);
+    for (int i = 0; i < m_number_joints; ++i)
+    {
+      m_current_velocities(i) = velocities(i);
+      m_last_velocities(i)    = m_current_velocities(i);
+    }
+  }
+
+  void IKSolver::synchronizeJointPositions(const KDL::JntArray& positions)
+  {
+    for (int i = 0; i < m_number_joints; ++i)
+    {
+      m_current_positions(i) = positions(i);
+      m_last_positions(i)    = m_current_positions(i);
+    }
+  }
+
+  void IKSolver::setToolFrame(int link, const KDL::Frame& offset)
+  {
+    m_kinematics.setTool(link, offset);
+  }
+
+  void IKSolver::updateKinematics()
+  {
+    // Pose and Jacobian w. r. t. base in one pass
+    m_kinematics.update(m_current_positions);
+    m_end_effector_pose = m_kinematics.getTipFrame();
+
+    // Absolute velocity w. r. t. base
+    m_end_effector_vel.noalias() = m_kinematics.getJacobian().data * m_current_velocities.data;
+  }
+
+  void IKSolver::applyJointLimits()
+  {
+    for (int i = 0; i < m_number_joints; ++i)
+    {
+      if (std::isnan(m_lower_pos_limits(i)) || std::isnan(m_upper_pos_limits(i)))
+      {
+        // Joint marked as continuous.
+        continue;
+      }
+      m_current_positions(i) = std::clamp(
+          m_current_positions(i),m_lower_pos_limits(i),m_upper_pos_limits(i));
+    }
+  }
+
+} // namespace core
+} // namespace cartesian_controller_base
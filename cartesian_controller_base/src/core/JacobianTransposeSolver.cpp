@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    JacobianTransposeSolver.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2020/03/26
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <cartesian_controller_base/core/JacobianTransposeSolver.h>
+
+namespace cartesian_controller_base{
+namespace core{
+
+  JacobianTransposeSolver::JacobianTransposeSolver()
+  {
+  }
+
+  JacobianTransposeSolver::~JacobianTransposeSolver(){}
+
+  void JacobianTransposeSolver::computeJointControlCmds(double period, const ctrl::Vector6D& net_force)
+  {
+    // Compute joint accelerations with the implementation for this chain's size
+    (this->*m_compute_joint_accelerations)(net_force);
+
+    // Integrate once, starting with zero motion
+    m_current_velocities.data = 0.5 * m_current_accelerations.data * period;
+
+    // Integrate twice, starting with zero motion
+    m_current_positions.data = m_last_positions.data + 0.5 * m_current_velocities.data * period;
+
+    // Make sure positions stay in allowed margins
+    applyJointLimits();
+
+    // Update for the next cycle
+    m_last_positions = m_current_positions;
+  }
+
+  template <int Dof>
+  void JacobianTransposeSolver::computeJointAccelerations(const ctrl::Vector6D& net_force)
+  {
+    // Get the joint Jacobian from the shared kinematics
+    const KDL::Jacobian& jacobian = getKinematics().getJacobian();
+    const Eigen::Map<const Eigen::Matrix<double, 6, Dof> > J(jacobian.data.data(), 6, m_number_joints);
+    Eigen::Map<Eigen::Matrix<double, Dof, 1> > q_ddot(m_current_accelerations.data.data(), m_number_joints);
+
+    // Compute joint accelerations according to: \f$ \ddot{q} = J^T f \f$
+    q_ddot.noalias() = J.transpose() * net_force;
+  }
+
+  bool JacobianTransposeSolver::init(const KDL::Chain& chain,
+                                     const KDL::JntArray& upper_pos_limits,
+                                     const KDL::JntArray& lower_pos_limits)
+  {
+    IKSolver::init(chain, upper_pos_limits, lower_pos_limits);
+
+    m_compute_joint_accelerations = dispatchJointCount(m_number_joints, [](auto N) {
+      return &JacobianTransposeSolver::computeJointAccelerations<decltype(N)::value>;
+    });
+
+    return true;
+  }
+
+} // namespace core
+} // namespace cartesian_controller_base
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    PDController.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2019/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <cartesian_controller_base/core/PDController.h>
+
+namespace cartesian_controller_base
+{
+namespace core
+{
+
+PDController::PDController()
+  : m_last_p_error(0.0)
+{
+}
+
+PDController::~PDController()
+{
+}
+
+double PDController::operator()(double error, double period)
+{
+  if (period == 0.0)
+  {
+    return 0.0;
+  }
+
+  double result = m_gains.p * error + m_gains.d * (error - m_last_p_error) / period;
+
+  m_last_p_error = error;
+  return result;
+}
+
+
+SpatialPDController::SpatialPDController()
+{
+}
+
+void SpatialPDController::setGains(const std::array<PDController::Gains, 6>& gains)
+{
+  for (int i = 0; i < 6; ++i)
+  {
+    m_pd_controllers[i].setGains(gains[i]);
+  }
+}
+
+ctrl::Vector6D SpatialPDController::operator()(const ctrl::Vector6D& error, double period)
+{
+  // Perform pd control separately on each Cartesian dimension
+  for (int i = 0; i < 6; ++i) // 3 transition, 3 rotation
+  {
+    m_cmd(i) = m_pd_controllers[i](error[i],period);
+  }
+  return m_cmd;
+}
+
+} // namespace core
+} // namespace cartesian_controller_base
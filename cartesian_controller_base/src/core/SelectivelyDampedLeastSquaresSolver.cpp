@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2019 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    SelectivelyDampedLeastSquaresSolver.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2020/03/27
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cartesian_controller_base/core/SelectivelyDampedLeastSquaresSolver.h>
+#include <cmath>
+
+namespace cartesian_controller_base{
+namespace core{
+
+  SelectivelyDampedLeastSquaresSolver::SelectivelyDampedLeastSquaresSolver()
+  {
+  }
+
+  SelectivelyDampedLeastSquaresSolver::~SelectivelyDampedLeastSquaresSolver(){}
+
+  void SelectivelyDampedLeastSquaresSolver::computeJointControlCmds(double period, const ctrl::Vector6D& net_force)
+  {
+    // Compute joint velocities with the implementation for this chain's size
+    (this->*m_compute_joint_velocities)(net_force);
+
+    // Integrate once, starting with zero motion
+    m_current_positions.data = m_last_positions.data + 0.5 * m_current_velocities.data * period;
+
+    // Make sure positions stay in allowed margins
+    applyJointLimits();
+
+    // Update for the next cycle
+    m_last_positions = m_current_positions;
+  }
+
+  template <int Dof>
+  void SelectivelyDampedLeastSquaresSolver::computeJointVelocities(const ctrl::Vector6D& net_force)
+  {
+    // Get the joint Jacobian from the shared kinematics
+    const KDL::Jacobian& jacobian = getKinematics().getJacobian();
+    const Eigen::Map<const Eigen::Matrix<double, 6, Dof> > J(jacobian.data.data(), 6, m_number_joints);
+    Eigen::Map<Eigen::Matrix<double, Dof, 1> > q_dot(m_current_velocities.data.data(), m_number_joints);
+    Eigen::Map<Eigen::Matrix<double, Dof, 1> > rho(m_rho.data(), m_number_joints);
+    Eigen::Map<Eigen::Matrix<double, Dof, 1> > phi(m_phi.data(), m_number_joints);
+
+    // Singular values and left singular vectors from the eigendecomposition
+    // of J J^T.  Eigenvalues are sorted in increasing order.
+    m_jjt.noalias() = J * J.transpose();
+    m_jjt_decomposition.compute(m_jjt);
+    const auto& eigenvalues = m_jjt_decomposition.eigenvalues();
+    const auto& U = m_jjt_decomposition.eigenvectors();
+
+    // These don't change within one step
+    for (int j = 0; j < m_number_joints; ++j)
+    {
+      rho[j] = J.col(j).template head<3>().norm();
+    }
+
+    // Default recommendation by Buss and Kim.
+    const double gamma_max = 3.141592653 / 4;
+
+    q_dot.setZero();
+
+    // Compute each joint velocity with the SDLS method.  This implements the
+    // algorithm as described in the paper (but for only one end-effector).
+    // Also see Buss' own implementation:
+    // https://www.math.ucsd.edu/~sbuss/ResearchWeb/ikmethods/index.html
+    //
+    // There are at most min(6, n) non-zero singular values.  Skip those that
+    // vanish numerically, since they don't contribute to the motion.
+    const int rank = std::min(6, m_number_joints);
+    for (int i = 5; i >= 6 - rank; --i)
+    {
+      if (eigenvalues[i] <= 1e-12 * eigenvalues[5])
+      {
+        break;
+      }
+      const double s = std::sqrt(eigenvalues[i]);
+
+      double alpha = U.col(i).dot(net_force);
+
+      double N = U.col(i).template head<3>().norm();
+
+      // Right singular vector
+      phi.noalias() = J.transpose() * U.col(i);
+      phi /= s;
+
+      double M = phi.cwiseAbs().dot(rho) / s;
+
+      double gamma = std::min(1.0, N / M) * gamma_max;
+
+      phi *= alpha / s;
+      clampMaxAbs(phi, gamma);
+      q_dot += phi;
+    }
+
+    clampMaxAbs(q_dot, gamma_max);
+  }
+
+  bool SelectivelyDampedLeastSquaresSolver::init(const KDL::Chain& chain,
+                                                 const KDL::JntArray& upper_pos_limits,
+                                                 const KDL::JntArray& lower_pos_limits)
+  {
+    IKSolver::init(chain, upper_pos_limits, lower_pos_limits);
+
+    m_rho = ctrl::VectorND::Zero(m_number_joints);
+    m_phi = ctrl::VectorND::Zero(m_number_joints);
+    m_compute_joint_velocities = dispatchJointCount(m_number_joints, [](auto N) {
+      return &SelectivelyDampedLeastSquaresSolver::computeJointVelocities<decltype(N)::value>;
+    });
+
+    return true;
+  }
+
+} // namespace core
+} // namespace cartesian_controller_base
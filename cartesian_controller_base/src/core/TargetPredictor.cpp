@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    TargetPredictor.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cartesian_controller_base/core/TargetPredictor.h>
+
+namespace cartesian_controller_base
+{
+namespace core
+{
+
+TargetPredictor::TargetPredictor()
+{
+}
+
+void TargetPredictor::init(size_t history, double max_age)
+{
+  m_samples.resize(std::max<size_t>(history, 2));
+  m_max_age = static_cast<int64_t>(std::max(max_age, 0.0) * 1e9);
+  reset();
+}
+
+void TargetPredictor::reset()
+{
+  m_newest = 0;
+  m_count = 0;
+  m_prediction = Prediction();
+}
+
+bool TargetPredictor::add(int64_t stamp, const KDL::Frame& pose)
+{
+  if (m_count > 0 && stamp <= m_samples[m_newest].stamp)
+  {
+    return false;
+  }
+
+  double x, y, z, w;
+  pose.M.GetQuaternion(x, y, z, w);
+  m_newest = (m_count > 0) ? (m_newest + 1) % m_samples.size() : 0;
+  m_count = std::min(m_count + 1, m_samples.size());
+  Sample& newest = m_samples[m_newest];
+  newest.stamp = stamp;
+  newest.position = Eigen::Vector3d(pose.p.x(), pose.p.y(), pose.p.z());
+  newest.orientation = Eigen::Quaterniond(w, x, y, z).normalized();
+
+  m_prediction.stamp = stamp;
+  m_prediction.pose = pose;
+
+  // Least-squares slopes of all samples relative to the newest one.
+  // Orientations are expressed as rotation vectors in the base frame.
+  const Eigen::Quaterniond inverse = newest.orientation.conjugate();
+  double mean_t = 0.0;
+  Eigen::Vector3d mean_p = Eigen::Vector3d::Zero();
+  Eigen::Vector3d mean_r = Eigen::Vector3d::Zero();
+  auto sample = [&](size_t i) -> const Sample& {
+    return m_samples[(m_newest + m_samples.size() - i) % m_samples.size()];
+  };
+  auto relative = [&](size_t i, double& t, Eigen::Vector3d& p, Eigen::Vector3d& r) {
+    const Eigen::AngleAxisd rotation(sample(i).orientation * inverse);
+    t = (sample(i).stamp - newest.stamp) * 1e-9;
+    p = sample(i).position - newest.position;
+    r = rotation.angle() * rotation.axis();
+  };
+
+  // Only recent samples count
+  size_t count = 1;
+  while (count < m_count && (m_max_age <= 0 || newest.stamp - sample(count).stamp <= m_max_age))
+  {
+    ++count;
+  }
+
+  for (size_t i = 0; i < count; ++i)
+  {
+    double t;
+    Eigen::Vector3d p, r;
+    relative(i, t, p, r);
+    mean_t += t / count;
+    mean_p += p / count;
+    mean_r += r / count;
+  }
+  double var_t = 0.0;
+  Eigen::Vector3d cov_p = Eigen::Vector3d::Zero();
+  Eigen::Vector3d cov_r = Eigen::Vector3d::Zero();
+  for (size_t i = 0; i < count; ++i)
+  {
+    double t;
+    Eigen::Vector3d p, r;
+    relative(i, t, p, r);
+    var_t += (t - mean_t) * (t - mean_t);
+    cov_p += (t - mean_t) * (p - mean_p);
+    cov_r += (t - mean_t) * (r - mean_r);
+  }
+
+  const Eigen::Vector3d v = (var_t > 0.0) ? Eigen::Vector3d(cov_p / var_t) : Eigen::Vector3d::Zero();
+  const Eigen::Vector3d omega = (var_t > 0.0) ? Eigen::Vector3d(cov_r / var_t) : Eigen::Vector3d::Zero();
+  m_prediction.linear_velocity = KDL::Vector(v.x(), v.y(), v.z());
+  m_prediction.angular_velocity = KDL::Vector(omega.x(), omega.y(), omega.z());
+  return true;
+}
+
+KDL::Frame TargetPredictor::extrapolate(const Prediction& prediction, int64_t time, double max_horizon)
+{
+  const double horizon = std::clamp((time - prediction.stamp) * 1e-9, 0.0, max_horizon);
+  if (horizon <= 0.0)
+  {
+    return prediction.pose;
+  }
+
+  const KDL::Vector& v = prediction.linear_velocity;
+  const Eigen::Vector3d omega(
+    prediction.angular_velocity.x(), prediction.angular_velocity.y(), prediction.angular_velocity.z());
+  double x, y, z, w;
+  prediction.pose.M.GetQuaternion(x, y, z, w);
+  Eigen::Quaterniond q(w, x, y, z);
+  const double angle = omega.norm() * horizon;
+  if (angle > 1e-12)
+  {
+    q = Eigen::AngleAxisd(angle, omega.normalized()) * q;
+  }
+
+  return KDL::Frame(KDL::Rotation::Quaternion(q.x(), q.y(), q.z(), q.w()),
+                    KDL::Vector(prediction.pose.p.x() + horizon * v.x(),
+                                prediction.pose.p.y() + horizon * v.y(),
+                                prediction.pose.p.z() + horizon * v.z()));
+}
+
+} // namespace core
+} // namespace cartesian_controller_base
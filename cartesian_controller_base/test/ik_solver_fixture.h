@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    ik_solver_fixture.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef TEST_IK_SOLVER_FIXTURE_H_INCLUDED
+#define TEST_IK_SOLVER_FIXTURE_H_INCLUDED
+
+#include <cartesian_controller_base/IKSolver.h>
+#include <cartesian_controller_base/Utility.h>
+#include <functional>
+#include <gtest/gtest.h>
+#include <hardware_interface/loaned_state_interface.hpp>
+#include <hardware_interface/types/hardware_interface_type_values.hpp>
+#include <kdl/chain.hpp>
+#include <kdl/jntarray.hpp>
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <trajectory_msgs/msg/joint_trajectory_point.hpp>
+#include <vector>
+
+namespace cartesian_controller_base
+{
+namespace test
+{
+
+/**
+ * @brief Common setup for testing IK solver plugins
+ *
+ * Each solver gets a fresh node for its parameters.  The node type follows
+ * the solvers' own choice in IKSolver.h.
+ */
+class IKSolverTest : public ::testing::Test
+{
+  public:
+#if defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
+    using NodeType = rclcpp_lifecycle::LifecycleNode;
+#else
+    using NodeType = rclcpp::Node;
+#endif
+
+    static void SetUpTestSuite() { rclcpp::init(0, nullptr); }
+    static void TearDownTestSuite() { rclcpp::shutdown(); }
+
+  protected:
+    //! A node with a unique name
+    std::shared_ptr<NodeType> makeNode()
+    {
+      static int instance = 0;
+      return std::make_shared<NodeType>("ik_solver_test_" + std::to_string(instance++));
+    }
+
+    /**
+     * @brief Initialize the solver on the given chain
+     *
+     * All joints may move within +/- 10 units.
+     *
+     * @return The node that holds the solver's parameters
+     */
+    std::shared_ptr<NodeType> init(IKSolver& solver, const KDL::Chain& chain)
+    {
+      auto node = makeNode();
+      KDL::JntArray upper_pos_limits(chain.getNrOfJoints());
+      KDL::JntArray lower_pos_limits(chain.getNrOfJoints());
+      upper_pos_limits.data.setConstant(10.0);
+      lower_pos_limits.data.setConstant(-10.0);
+      EXPECT_TRUE(solver.init(node, chain, upper_pos_limits, lower_pos_limits));
+      return node;
+    }
+
+    //! Set the solver's joint positions and bring it to rest
+    void setStartState(IKSolver& solver, const KDL::JntArray& positions)
+    {
+      std::vector<double> values(positions.data.data(), positions.data.data() + positions.rows());
+      std::vector<hardware_interface::StateInterface> interfaces;
+      for (size_t i = 0; i < values.size(); ++i)
+      {
+        interfaces.emplace_back(
+          "joint_" + std::to_string(i), hardware_interface::HW_IF_POSITION, &values[i]);
+      }
+      std::vector<hardware_interface::LoanedStateInterface> loaned;
+      for (auto& interface : interfaces)
+      {
+        loaned.emplace_back(interface);
+      }
+      std::vector<std::reference_wrapper<hardware_interface::LoanedStateInterface> > handles(
+        loaned.begin(), loaned.end());
+      ASSERT_TRUE(solver.setStartState(handles));
+      solver.updateKinematics();
+    }
+
+    //! Joint velocities after one control step of the given duration
+    ctrl::VectorND step(IKSolver& solver, const ctrl::Vector6D& net_force, double period)
+    {
+      trajectory_msgs::msg::JointTrajectoryPoint control_cmd =
+        solver.getJointControlCmds(rclcpp::Duration::from_seconds(period), net_force);
+      solver.updateKinematics();
+      return Eigen::Map<const ctrl::VectorND>(control_cmd.velocities.data(), control_cmd.velocities.size());
+    }
+};
+
+} // namespace test
+} // namespace cartesian_controller_base
+
+#endif
@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    random_chain.h
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#ifndef TEST_RANDOM_CHAIN_H_INCLUDED
+#define TEST_RANDOM_CHAIN_H_INCLUDED
+
+#include <kdl/chain.hpp>
+#include <kdl/jntarray.hpp>
+#include <random>
+#include <string>
+
+namespace cartesian_controller_base
+{
+namespace test
+{
+
+/**
+ * @brief A random serial chain for testing kinematics and dynamics
+ *
+ * Revolute and prismatic joints have arbitrary axes and origins.  Fixed
+ * segments are inserted at random, including before the first and after the
+ * last joint.
+ *
+ * @param joints The number of joints
+ * @param rng The random number generator
+ *
+ * @return The chain with segments named link_0, link_1, ...
+ */
+inline KDL::Chain randomChain(unsigned int joints, std::mt19937& rng)
+{
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  std::bernoulli_distribution coin(0.3);
+
+  auto vector = [&]() { return KDL::Vector(uniform(rng), uniform(rng), uniform(rng)); };
+  auto frame = [&]() {
+    return KDL::Frame(KDL::Rotation::RPY(3.0 * uniform(rng), 1.5 * uniform(rng), 3.0 * uniform(rng)),
+                      0.3 * vector());
+  };
+
+  KDL::Chain chain;
+  int segment = 0;
+  auto add_fixed = [&]() {
+    chain.addSegment(KDL::Segment("link_" + std::to_string(segment++), KDL::Joint(KDL::Joint::None), frame()));
+  };
+
+  if (coin(rng))
+  {
+    add_fixed();
+  }
+  for (unsigned int i = 0; i < joints; ++i)
+  {
+    const KDL::Joint::JointType type = coin(rng) ? KDL::Joint::TransAxis : KDL::Joint::RotAxis;
+    KDL::Vector axis = vector();
+    axis = axis / axis.Norm();
+    chain.addSegment(KDL::Segment("link_" + std::to_string(segment++),
+                                  KDL::Joint("joint_" + std::to_string(i), 0.1 * vector(), axis, type),
+                                  frame()));
+    while (coin(rng))
+    {
+      add_fixed();
+    }
+  }
+  return chain;
+}
+
+//! Random joint positions for the given chain
+inline KDL::JntArray randomPositions(const KDL::Chain& chain, std::mt19937& rng)
+{
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+  KDL::JntArray positions(chain.getNrOfJoints());
+  for (unsigned int i = 0; i < chain.getNrOfJoints(); ++i)
+  {
+    positions(i) = uniform(rng);
+  }
+  return positions;
+}
+
+} // namespace test
+} // namespace cartesian_controller_base
+
+#endif
@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    test_articulated_body_solver.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include "ik_solver_fixture.h"
+#include "random_chain.h"
+#include <cartesian_controller_base/ArticulatedBodySolver.h>
+#include <cartesian_controller_base/KinematicsCache.h>
+#include <random>
+#include <vector>
+
+using cartesian_controller_base::ArticulatedBodySolver;
+using cartesian_controller_base::KinematicsCache;
+using cartesian_controller_base::test::randomChain;
+using cartesian_controller_base::test::randomPositions;
+
+namespace
+{
+
+const std::string link_mass_parameter = "solver/articulated_body/link_mass";
+
+/**
+ * @brief Joint accelerations of the generic model with the dense joint space inertia matrix
+ *
+ * Computes \f$ \ddot{q} = H^{-1} ( J^T f) \f$ with the same masses and
+ * inertias as the solvers' generic model: each moving segment has the link
+ * mass in its tip, the last segment has unit mass and inertia, and fixed
+ * segments move with their predecessors.  All Jacobians are central finite
+ * differences of the cached link poses.
+ */
+ctrl::VectorND referenceAccelerations(const KDL::Chain& chain,
+                                      const KDL::JntArray& positions,
+                                      int tool,
+                                      const KDL::Frame& tool_offset,
+                                      double link_mass,
+                                      const ctrl::Vector6D& net_force)
+{
+  const int joints = chain.getNrOfJoints();
+  const int segments = chain.getNrOfSegments();
+  KinematicsCache kinematics;
+  kinematics.init(chain);
+  kinematics.setTool(tool, tool_offset);
+
+  // Linear and angular Jacobians of each segment tip and of the TCP
+  std::vector<ctrl::MatrixND> linear(segments + 1, ctrl::MatrixND::Zero(3, joints));
+  std::vector<ctrl::MatrixND> angular(segments + 1, ctrl::MatrixND::Zero(3, joints));
+  const double h = 1e-6;
+  for (int j = 0; j < joints; ++j)
+  {
+    KDL::JntArray q = positions;
+    q(j) = positions(j) + h;
+    kinematics.update(q);
+    std::vector<KDL::Frame> plus(segments + 1);
+    for (int s = 0; s < segments; ++s)
+    {
+      plus[s] = kinematics.getFrame(s + 1);
+    }
+    plus[segments] = kinematics.getTipFrame();
+
+    q(j) = positions(j) - h;
+    kinematics.update(q);
+    for (int s = 0; s <= segments; ++s)
+    {
+      const KDL::Frame minus = (s < segments) ? kinematics.getFrame(s + 1) : kinematics.getTipFrame();
+      const KDL::Vector v = (plus[s].p - minus.p) / (2.0 * h);
+      const KDL::Vector w = (plus[s].M * minus.M.Inverse()).GetRot() / (2.0 * h);
+      linear[s].col(j) << v.x(), v.y(), v.z();
+      angular[s].col(j) << w.x(), w.y(), w.z();
+    }
+  }
+
+  ctrl::MatrixND inertia = ctrl::MatrixND::Zero(joints, joints);
+  for (int s = 0; s < segments; ++s)
+  {
+    const bool moving = chain.getSegment(s).getJoint().getType() != KDL::Joint::None;
+    const bool last = s == segments - 1;
+    const double mass = last ? 1.0 : (moving ? link_mass : 0.0);
+    const double rotational = last ? 1.0 : (moving ? 0.000001 : 0.0);
+    inertia += mass * linear[s].transpose() * linear[s] + rotational * angular[s].transpose() * angular[s];
+  }
+
+  ctrl::MatrixND jacobian(6, joints);
+  jacobian << linear[segments], angular[segments];
+  return inertia.fullPivLu().solve(jacobian.transpose() * net_force);
+}
+
+} // namespace
+
+class ArticulatedBodySolverTest : public cartesian_controller_base::test::IKSolverTest
+{
+};
+
+TEST_F(ArticulatedBodySolverTest, RejectsChainsWithoutJoints)
+{
+  KDL::Chain chain;
+  chain.addSegment(KDL::Segment("flange", KDL::Joint(KDL::Joint::None), KDL::Frame(KDL::Vector(0, 0, 0.1))));
+  ArticulatedBodySolver solver;
+  EXPECT_FALSE(solver.init(makeNode(), chain, KDL::JntArray(0), KDL::JntArray(0)));
+}
+
+TEST_F(ArticulatedBodySolverTest, AcceleratesPrismaticChainsLikePointMasses)
+{
+  // Two orthogonal prismatic joints.  The first one moves both the link
+  // mass and the end effector's unit mass.
+  KDL::Chain chain;
+  chain.addSegment(KDL::Segment("x", KDL::Joint("x", KDL::Joint::TransX), KDL::Frame(KDL::Vector(0.1, 0, 0))));
+  chain.addSegment(KDL::Segment("y", KDL::Joint("y", KDL::Joint::TransY), KDL::Frame(KDL::Vector(0, 0.1, 0))));
+
+  const double link_mass = 0.5;
+  const double period = 0.01;
+  ArticulatedBodySolver solver;
+  auto node = init(solver, chain);
+  ASSERT_TRUE(node->set_parameter(rclcpp::Parameter(link_mass_parameter, link_mass)).successful);
+  setStartState(solver, KDL::JntArray(2));
+
+  ctrl::Vector6D force = ctrl::Vector6D::Zero();
+  force << 3.0, 2.0, 0.0, 0.0, 0.0, 0.0;
+  const ctrl::VectorND velocities = step(solver, force, period);
+
+  // One Euler step from rest with 10 % damping
+  EXPECT_NEAR(velocities(0), 0.9 * period * 3.0 / (link_mass + 1.0), 1e-12);
+  EXPECT_NEAR(velocities(1), 0.9 * period * 2.0, 1e-12);
+  EXPECT_DOUBLE_EQ(solver.getPositions()(0), 0.0);
+  EXPECT_DOUBLE_EQ(solver.getPositions()(1), 0.0);
+}
+
+TEST_F(ArticulatedBodySolverTest, MovesAlongTheForce)
+{
+  std::mt19937 rng(5);
+  for (int trial = 0; trial < 20; ++trial)
+  {
+    const KDL::Chain chain = randomChain(3 + trial % 13, rng);
+    ArticulatedBodySolver solver;
+    auto node = init(solver, chain);
+    setStartState(solver, randomPositions(chain, rng));
+
+    const ctrl::Vector6D force = ctrl::Vector6D::Random();
+    const ctrl::VectorND velocities = step(solver, force, 0.01);
+
+    // The virtual system gains energy from the applied force
+    EXPECT_GT(force.dot(solver.getEndEffectorVel()), 0.0);
+
+    // Without force, the velocities decay without accelerations
+    EXPECT_TRUE(step(solver, ctrl::Vector6D::Zero(), 0.01).isApprox(0.9 * velocities));
+  }
+}
+
+TEST_F(ArticulatedBodySolverTest, RespectsJointLimits)
+{
+  KDL::Chain chain;
+  chain.addSegment(KDL::Segment("x", KDL::Joint("x", KDL::Joint::TransX), KDL::Frame(KDL::Vector(0.1, 0, 0))));
+  KDL::JntArray upper(1);
+  KDL::JntArray lower(1);
+  upper(0) = 0.001;
+  lower(0) = -0.001;
+
+  ArticulatedBodySolver solver;
+  ASSERT_TRUE(solver.init(makeNode(), chain, upper, lower));
+  setStartState(solver, KDL::JntArray(1));
+  ctrl::Vector6D force = ctrl::Vector6D::Zero();
+  force(0) = 100.0;
+  for (int i = 0; i < 10; ++i)
+  {
+    step(solver, force, 0.01);
+    EXPECT_LE(solver.getPositions()(0), upper(0));
+  }
+  EXPECT_DOUBLE_EQ(solver.getPositions()(0), upper(0));
+}
+
+TEST_F(ArticulatedBodySolverTest, MatchesDenseForwardDynamics)
+{
+  std::mt19937 rng(6);
+  for (int trial = 0; trial < 50; ++trial)
+  {
+    const KDL::Chain chain = randomChain(3 + trial % 13, rng);
+    const KDL::JntArray positions = randomPositions(chain, rng);
+    const double link_mass = std::uniform_real_distribution<double>(0.05, 1.0)(rng);
+    const double period = 0.01;
+
+    ArticulatedBodySolver solver;
+    auto node = init(solver, chain);
+    ASSERT_TRUE(node->set_parameter(rclcpp::Parameter(link_mass_parameter, link_mass)).successful);
+
+    // Every other trial with the TCP on a random link behind the first joint
+    int tool = solver.getKinematics().getNrOfFrames() - 1;
+    KDL::Frame tool_offset = KDL::Frame::Identity();
+    if (trial % 2)
+    {
+      const int first = chain.getSegment(0).getJoint().getType() == KDL::Joint::None ? 2 : 1;
+      tool = std::uniform_int_distribution<int>(first, tool)(rng);
+      tool_offset = KDL::Frame(KDL::Rotation::RotY(0.2), KDL::Vector(0.0, 0.1, 0.15));
+    }
+    solver.core().setToolFrame(tool, tool_offset);
+    setStartState(solver, positions);
+
+    const ctrl::Vector6D force = ctrl::Vector6D::Random();
+
+    // One Euler step from rest with 10 % damping
+    const ctrl::VectorND accelerations = step(solver, force, period) / (0.9 * period);
+    const ctrl::VectorND reference =
+      referenceAccelerations(chain, positions, tool, tool_offset, link_mass, force);
+    EXPECT_LT((accelerations - reference).norm(), 1e-6 * reference.norm())
+      << chain.getNrOfJoints() << " joints, " << chain.getNrOfSegments() << " segments, tool " << tool;
+  }
+}
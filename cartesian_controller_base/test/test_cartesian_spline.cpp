@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    test_cartesian_spline.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <cartesian_controller_base/core/CartesianSpline.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using cartesian_controller_base::core::CartesianSpline;
+
+namespace
+{
+
+void expectNear(const KDL::Frame& a, const KDL::Frame& b, double tolerance)
+{
+  for (int i = 0; i < 3; ++i)
+  {
+    EXPECT_NEAR(a.p(i), b.p(i), tolerance);
+    for (int j = 0; j < 3; ++j)
+    {
+      EXPECT_NEAR(a.M(i, j), b.M(i, j), tolerance);
+    }
+  }
+}
+
+// Linear and angular velocity by central differences
+KDL::Twist velocity(const CartesianSpline& spline, double time)
+{
+  const double h = 1e-6;
+  size_t segment = 0;
+  const KDL::Frame plus = spline.evaluate(time + h, segment);
+  segment = 0;
+  const KDL::Frame minus = spline.evaluate(time - h, segment);
+  return KDL::Twist((plus.p - minus.p) / (2.0 * h), (plus.M * minus.M.Inverse()).GetRot() / (2.0 * h));
+}
+
+std::vector<CartesianSpline::Waypoint> waypoints()
+{
+  std::vector<CartesianSpline::Waypoint> waypoints(3);
+  waypoints[0].time = 1.0;
+  waypoints[0].pose = KDL::Frame(KDL::Rotation::RPY(0.1, 0.2, 0.3), KDL::Vector(0.3, 0.0, 0.5));
+  waypoints[1].time = 2.0;
+  waypoints[1].pose = KDL::Frame(KDL::Rotation::RPY(0.5, -0.2, 1.0), KDL::Vector(0.4, 0.2, 0.4));
+  waypoints[2].time = 3.5;
+  waypoints[2].pose = KDL::Frame(KDL::Rotation::RPY(-0.3, 0.4, 2.0), KDL::Vector(0.2, 0.3, 0.6));
+  return waypoints;
+}
+
+} // namespace
+
+TEST(CartesianSpline, RejectsInvalidWaypoints)
+{
+  CartesianSpline spline;
+  std::string error;
+  EXPECT_FALSE(spline.init({}, error));
+  EXPECT_FALSE(error.empty());
+
+  std::vector<CartesianSpline::Waypoint> unordered = waypoints();
+  unordered[2].time = unordered[1].time;
+  EXPECT_FALSE(spline.init(unordered, error));
+}
+
+TEST(CartesianSpline, PassesThroughWaypoints)
+{
+  CartesianSpline spline;
+  std::string error;
+  ASSERT_TRUE(spline.init(waypoints(), error)) << error;
+  EXPECT_DOUBLE_EQ(spline.duration(), 3.5);
+
+  size_t segment = 0;
+  for (const CartesianSpline::Waypoint& waypoint : waypoints())
+  {
+    expectNear(spline.evaluate(waypoint.time, segment), waypoint.pose, 1e-9);
+  }
+
+  // Hold the first and the last pose
+  segment = 0;
+  expectNear(spline.evaluate(-1.0, segment), waypoints().front().pose, 1e-9);
+  expectNear(spline.evaluate(0.0, segment), waypoints().front().pose, 1e-9);
+  expectNear(spline.evaluate(10.0, segment), waypoints().back().pose, 1e-9);
+}
+
+TEST(CartesianSpline, HasContinuousVelocities)
+{
+  std::vector<CartesianSpline::Waypoint> immediate = waypoints();
+  immediate[0].time = 0.0;
+  CartesianSpline spline;
+  std::string error;
+  ASSERT_TRUE(spline.init(immediate, error)) << error;
+
+  // The translation starts and ends at rest
+  EXPECT_LT(velocity(spline, 1e-3).vel.Norm(), 1e-2);
+  EXPECT_LT(velocity(spline, 3.5 - 1e-3).vel.Norm(), 1e-2);
+
+  // No jumps across the inner waypoint
+  const KDL::Twist before = velocity(spline, 2.0 - 1e-4);
+  const KDL::Twist after = velocity(spline, 2.0 + 1e-4);
+  EXPECT_LT((before.vel - after.vel).Norm(), 1e-2);
+  EXPECT_LT((before.rot - after.rot).Norm(), 1e-2);
+  EXPECT_GT(before.vel.Norm(), 0.01);
+}
+
+TEST(CartesianSpline, StartsFromTheGivenPose)
+{
+  CartesianSpline spline;
+  std::string error;
+  ASSERT_TRUE(spline.init(waypoints(), error)) << error;
+
+  const KDL::Frame start(KDL::Rotation::RotZ(-0.5), KDL::Vector(0.1, -0.2, 0.3));
+  spline.setStart(start);
+
+  size_t segment = 0;
+  expectNear(spline.evaluate(0.0, segment), start, 1e-9);
+  for (const CartesianSpline::Waypoint& waypoint : waypoints())
+  {
+    expectNear(spline.evaluate(waypoint.time, segment), waypoint.pose, 1e-9);
+  }
+  EXPECT_LT(velocity(spline, 1e-3).vel.Norm(), 1e-2);
+
+  // The first waypoint is an inner one now
+  const KDL::Twist before = velocity(spline, 1.0 - 1e-4);
+  const KDL::Twist after = velocity(spline, 1.0 + 1e-4);
+  EXPECT_LT((before.vel - after.vel).Norm(), 1e-2);
+  EXPECT_LT((before.rot - after.rot).Norm(), 1e-2);
+}
+
+TEST(CartesianSpline, IgnoresStartWithWaypointAtTimeZero)
+{
+  std::vector<CartesianSpline::Waypoint> immediate = waypoints();
+  immediate[0].time = 0.0;
+  CartesianSpline spline;
+  std::string error;
+  ASSERT_TRUE(spline.init(immediate, error)) << error;
+
+  spline.setStart(KDL::Frame(KDL::Vector(1.0, 1.0, 1.0)));
+  size_t segment = 0;
+  expectNear(spline.evaluate(0.0, segment), immediate[0].pose, 1e-9);
+}
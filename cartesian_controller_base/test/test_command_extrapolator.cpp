@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    test_command_extrapolator.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <cartesian_controller_base/core/CommandExtrapolator.h>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+using cartesian_controller_base::core::CommandExtrapolator;
+
+namespace
+{
+
+// A limited and a continuous joint
+CommandExtrapolator extrapolator()
+{
+  KDL::JntArray upper(2);
+  KDL::JntArray lower(2);
+  upper(0) = 1.0;
+  lower(0) = -1.0;
+  upper(1) = std::numeric_limits<double>::quiet_NaN();
+  lower(1) = std::numeric_limits<double>::quiet_NaN();
+
+  CommandExtrapolator extrapolator;
+  extrapolator.init(upper, lower);
+  return extrapolator;
+}
+
+} // namespace
+
+TEST(CommandExtrapolator, StartsAtRest)
+{
+  CommandExtrapolator commands = extrapolator();
+  commands.reset({0.1, 0.2}, {0.3, 0.4});
+
+  std::vector<double> positions(2);
+  std::vector<double> velocities(2);
+  for (int order = 0; order <= CommandExtrapolator::MAX_ORDER; ++order)
+  {
+    commands.extrapolate(order, 0.5, positions, velocities);
+    EXPECT_DOUBLE_EQ(positions[0], 0.1);
+    EXPECT_DOUBLE_EQ(positions[1], 0.2);
+  }
+
+  // The velocities only hold without history
+  commands.extrapolate(0, 0.5, positions, velocities);
+  EXPECT_DOUBLE_EQ(velocities[0], 0.3);
+  EXPECT_DOUBLE_EQ(velocities[1], 0.4);
+}
+
+TEST(CommandExtrapolator, ReproducesPolynomialsOfItsOrder)
+{
+  // Quadratic motion over solver cycles
+  auto x = [](double t) { return 0.1 + 0.02 * t - 0.01 * t * t; };
+  auto v = [](double t) { return 0.02 - 0.02 * t; };
+
+  CommandExtrapolator commands = extrapolator();
+  commands.reset({x(-2.0), 0.0}, {v(-2.0), 0.0});
+  commands.push({x(-1.0), 0.0}, {v(-1.0), 0.0});
+  commands.push({x(0.0), 0.0}, {v(0.0), 0.0});
+
+  std::vector<double> positions;
+  std::vector<double> velocities;
+  for (double t : {0.0, 0.25, 0.5, 1.0})
+  {
+    commands.extrapolate(2, t, positions, velocities);
+    ASSERT_EQ(positions.size(), 2u);
+    EXPECT_NEAR(positions[0], x(t), 1e-12);
+    EXPECT_NEAR(velocities[0], v(t), 1e-12);
+
+    commands.extrapolate(1, t, positions, velocities);
+    EXPECT_NEAR(positions[0], x(0.0) + t * (x(0.0) - x(-1.0)), 1e-12);
+    EXPECT_NEAR(velocities[0], v(t), 1e-12);
+
+    commands.extrapolate(0, t, positions, velocities);
+    EXPECT_DOUBLE_EQ(positions[0], x(0.0));
+    EXPECT_DOUBLE_EQ(velocities[0], v(0.0));
+  }
+}
+
+TEST(CommandExtrapolator, ClampsToJointLimits)
+{
+  CommandExtrapolator commands = extrapolator();
+  commands.reset({0.8, 0.8}, {0.0, 0.0});
+  commands.push({0.9, 0.9}, {0.0, 0.0});
+  commands.push({1.0, 1.0}, {0.0, 0.0});
+
+  std::vector<double> positions(2);
+  std::vector<double> velocities(2);
+  commands.extrapolate(1, 1.0, positions, velocities);
+  EXPECT_DOUBLE_EQ(positions[0], 1.0);
+  EXPECT_NEAR(positions[1], 1.1, 1e-12);  // continuous
+}
@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    test_damped_least_squares_solver.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include "ik_solver_fixture.h"
+#include "random_chain.h"
+#include <cartesian_controller_base/DampedLeastSquaresSolver.h>
+#include <kdl/chainjnttojacsolver.hpp>
+#include <random>
+
+using cartesian_controller_base::DampedLeastSquaresSolver;
+using cartesian_controller_base::test::randomChain;
+using cartesian_controller_base::test::randomPositions;
+
+namespace
+{
+
+const std::string alpha_parameter = "solver/damped_least_squares/alpha";
+
+//! Joint velocities with a dense inverse: \f$ J^T ( J J^T + \alpha^2 I )^{-1} f \f$
+ctrl::VectorND referenceVelocities(const KDL::Chain& chain,
+                                   const KDL::JntArray& positions,
+                                   double alpha,
+                                   const ctrl::Vector6D& net_force)
+{
+  KDL::Jacobian jacobian(chain.getNrOfJoints());
+  KDL::ChainJntToJacSolver(chain).JntToJac(positions, jacobian);
+  const ctrl::Matrix6D task_space =
+    jacobian.data * jacobian.data.transpose() + alpha * alpha * ctrl::Matrix6D::Identity();
+  return jacobian.data.transpose() * task_space.inverse() * net_force;
+}
+
+} // namespace
+
+class DampedLeastSquaresSolverTest
+  : public cartesian_controller_base::test::IKSolverTest
+  , public ::testing::WithParamInterface<int>
+{
+};
+
+TEST_P(DampedLeastSquaresSolverTest, MatchesDenseInverse)
+{
+  const unsigned int joints = GetParam();
+  std::mt19937 rng(joints);
+  for (int trial = 0; trial < 20; ++trial)
+  {
+    const KDL::Chain chain = randomChain(joints, rng);
+    const KDL::JntArray positions = randomPositions(chain, rng);
+    const double alpha = std::uniform_real_distribution<double>(0.01, 2.0)(rng);
+
+    DampedLeastSquaresSolver solver;
+    auto node = init(solver, chain);
+    ASSERT_TRUE(node->set_parameter(rclcpp::Parameter(alpha_parameter, alpha)).successful);
+    setStartState(solver, positions);
+
+    const ctrl::Vector6D net_force = ctrl::Vector6D::Random();
+    const ctrl::VectorND velocities = step(solver, net_force, 0.01);
+    const ctrl::VectorND reference = referenceVelocities(chain, positions, alpha, net_force);
+    ASSERT_EQ(velocities.size(), reference.size());
+    EXPECT_LT((velocities - reference).norm(), 1e-9 * reference.norm()) << "alpha " << alpha;
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(JointCounts, DampedLeastSquaresSolverTest, ::testing::Values(1, 3, 5, 6, 7, 9, 15));
+
+TEST_F(DampedLeastSquaresSolverTest, RejectsNonPositiveDamping)
+{
+  std::mt19937 rng(1);
+  DampedLeastSquaresSolver solver;
+  auto node = init(solver, randomChain(4, rng));
+  EXPECT_FALSE(node->set_parameter(rclcpp::Parameter(alpha_parameter, 0.0)).successful);
+  EXPECT_FALSE(node->set_parameter(rclcpp::Parameter(alpha_parameter, -0.5)).successful);
+  EXPECT_TRUE(node->set_parameter(rclcpp::Parameter(alpha_parameter, 1e-3)).successful);
+}
@@ -0,0 +1,261 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    test_forward_dynamics_solver.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include "ik_solver_fixture.h"
+#include "random_chain.h"
+#include <cartesian_controller_base/ForwardDynamicsSolver.h>
+#include <kdl/chaindynparam.hpp>
+#include <kdl/chainjnttojacsolver.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+using cartesian_controller_base::ForwardDynamicsSolver;
+using cartesian_controller_base::test::randomChain;
+using cartesian_controller_base::test::randomPositions;
+
+namespace
+{
+
+const double period = 0.001;
+
+/**
+ * @brief Joint accelerations with a dense inverse of the inertia matrix
+ *
+ * This mirrors the solver's generic model and computes
+ * \f$ \ddot{q} = H^{-1} ( J^T f) \f$ without decompositions.
+ */
+ctrl::VectorND referenceAccelerations(KDL::Chain chain,
+                                      double link_mass,
+                                      const KDL::JntArray& positions,
+                                      const ctrl::Vector6D& net_force)
+{
+  for (KDL::Segment& segment : chain.segments)
+  {
+    segment.setInertia(segment.getJoint().getType() == KDL::Joint::None
+                         ? KDL::RigidBodyInertia::Zero()
+                         : KDL::RigidBodyInertia(link_mass, KDL::Vector::Zero(),
+                                                 KDL::RotationalInertia(1e-6, 1e-6, 1e-6)));
+  }
+  chain.segments.back().setInertia(
+    KDL::RigidBodyInertia(1.0, KDL::Vector::Zero(), KDL::RotationalInertia(1.0, 1.0, 1.0)));
+
+  KDL::JntSpaceInertiaMatrix inertia(chain.getNrOfJoints());
+  KDL::ChainDynParam(chain, KDL::Vector::Zero()).JntToMass(positions, inertia);
+  KDL::Jacobian jacobian(chain.getNrOfJoints());
+  KDL::ChainJntToJacSolver(chain).JntToJac(positions, jacobian);
+
+  return inertia.data.inverse() * jacobian.data.transpose() * net_force;
+}
+
+/**
+ * @brief Joint accelerations from a dense inertia matrix of the full chain
+ *
+ * This is independent of how the solver merges fixed segments.  The inertia
+ * matrix sums \f$ J_i^T M_i J_i \f$ over all segment tips, with the same
+ * masses as the solver's generic model.  Fixed segments carry no inertia,
+ * except when they are the last one.  The Jacobians are central finite
+ * differences of the segment poses.
+ */
+ctrl::VectorND denseAccelerations(const KDL::Chain& chain,
+                                  double link_mass,
+                                  const KDL::JntArray& positions,
+                                  const ctrl::Vector6D& net_force)
+{
+  const int joints = chain.getNrOfJoints();
+  const int segments = chain.getNrOfSegments();
+  auto tips = [&](const KDL::JntArray& q) {
+    std::vector<KDL::Frame> frames;
+    KDL::Frame frame = KDL::Frame::Identity();
+    int joint = 0;
+    for (const KDL::Segment& segment : chain.segments)
+    {
+      const bool moving = segment.getJoint().getType() != KDL::Joint::None;
+      frame = frame * segment.pose(moving ? q(joint++) : 0.0);
+      frames.push_back(frame);
+    }
+    return frames;
+  };
+
+  std::vector<ctrl::MatrixND> jacobians(segments, ctrl::MatrixND::Zero(6, joints));
+  const double h = 1e-6;
+  for (int j = 0; j < joints; ++j)
+  {
+    KDL::JntArray q = positions;
+    q(j) = positions(j) + h;
+    const std::vector<KDL::Frame> plus = tips(q);
+    q(j) = positions(j) - h;
+    const std::vector<KDL::Frame> minus = tips(q);
+    for (int s = 0; s < segments; ++s)
+    {
+      const KDL::Vector v = (plus[s].p - minus[s].p) / (2.0 * h);
+      const KDL::Vector w = (plus[s].M * minus[s].M.Inverse()).GetRot() / (2.0 * h);
+      jacobians[s].col(j) << v.x(), v.y(), v.z(), w.x(), w.y(), w.z();
+    }
+  }
+
+  ctrl::MatrixND inertia = ctrl::MatrixND::Zero(joints, joints);
+  for (int s = 0; s < segments; ++s)
+  {
+    const bool moving = chain.getSegment(s).getJoint().getType() != KDL::Joint::None;
+    const bool last = s == segments - 1;
+    const double mass = last ? 1.0 : (moving ? link_mass : 0.0);
+    const double rotational = last ? 1.0 : (moving ? 0.000001 : 0.0);
+    inertia += mass * jacobians[s].topRows(3).transpose() * jacobians[s].topRows(3) +
+               rotational * jacobians[s].bottomRows(3).transpose() * jacobians[s].bottomRows(3);
+  }
+  return inertia.fullPivLu().solve(jacobians.back().transpose() * net_force);
+}
+
+//! A random chain with fixed segments before the first and after the last joint
+KDL::Chain chainWithFixedSegments(unsigned int joints, std::mt19937& rng)
+{
+  auto fixed = [&](const std::string& name) {
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    return KDL::Segment(name, KDL::Joint(KDL::Joint::None),
+                        KDL::Frame(KDL::Rotation::RPY(uniform(rng), uniform(rng), uniform(rng)),
+                                   KDL::Vector(0.2 * uniform(rng), 0.2 * uniform(rng), 0.2 * uniform(rng))));
+  };
+
+  KDL::Chain chain;
+  chain.addSegment(fixed("base_mount"));
+  for (const KDL::Segment& segment : randomChain(joints, rng).segments)
+  {
+    chain.addSegment(segment);
+  }
+  chain.addSegment(fixed("flange"));
+  chain.addSegment(fixed("tool"));
+  return chain;
+}
+
+// The solver damps velocities by 10 % in each step
+ctrl::VectorND accelerationsFromRest(const ctrl::VectorND& velocities)
+{
+  return velocities / (0.9 * period);
+}
+
+} // namespace
+
+class ForwardDynamicsSolverTest : public cartesian_controller_base::test::IKSolverTest
+{
+};
+
+TEST_F(ForwardDynamicsSolverTest, MatchesInverseInertiaBaseline)
+{
+  std::mt19937 rng(1);
+  for (int trial = 0; trial < 50; ++trial)
+  {
+    const KDL::Chain chain = randomChain(1 + trial % 12, rng);
+    ForwardDynamicsSolver solver;
+    auto node = init(solver, chain);
+
+    const KDL::JntArray positions = randomPositions(chain, rng);
+    setStartState(solver, positions);
+    const ctrl::Vector6D net_force = ctrl::Vector6D::Random();
+
+    const ctrl::VectorND accelerations = accelerationsFromRest(step(solver, net_force, period));
+    const ctrl::VectorND reference = referenceAccelerations(chain, 0.1, positions, net_force);
+    ASSERT_EQ(accelerations.size(), reference.size());
+    EXPECT_LT((accelerations - reference).norm(), 1e-6 * reference.norm()) << "trial " << trial;
+  }
+}
+
+TEST_F(ForwardDynamicsSolverTest, MatchesDenseForwardDynamicsWithFixedSegments)
+{
+  std::mt19937 rng(3);
+  for (int trial = 0; trial < 30; ++trial)
+  {
+    const KDL::Chain chain = chainWithFixedSegments(1 + trial % 10, rng);
+    const double link_mass = std::uniform_real_distribution<double>(0.05, 2.0)(rng);
+    ForwardDynamicsSolver solver;
+    auto node = init(solver, chain);
+    ASSERT_TRUE(
+      node->set_parameter(rclcpp::Parameter("solver/forward_dynamics/link_mass", link_mass)).successful);
+
+    const KDL::JntArray positions = randomPositions(chain, rng);
+    setStartState(solver, positions);
+    const ctrl::Vector6D net_force = ctrl::Vector6D::Random();
+
+    const ctrl::VectorND accelerations = accelerationsFromRest(step(solver, net_force, period));
+    const ctrl::VectorND reference = denseAccelerations(chain, link_mass, positions, net_force);
+    ASSERT_EQ(accelerations.size(), reference.size());
+    EXPECT_LT((accelerations - reference).norm(), 1e-6 * reference.norm())
+      << chain.getNrOfJoints() << " joints, " << chain.getNrOfSegments() << " segments";
+  }
+}
+
+TEST_F(ForwardDynamicsSolverTest, RebuildsModelOnlyOnLinkMassChanges)
+{
+  std::mt19937 rng(2);
+  const KDL::Chain chain = randomChain(6, rng);
+  const KDL::JntArray positions = randomPositions(chain, rng);
+  ctrl::Vector6D net_force;
+  net_force << 1.0, -2.0, 0.5, 0.1, 0.3, -0.2;
+  const std::string link_mass = "solver/forward_dynamics/link_mass";
+
+  ForwardDynamicsSolver solver;
+  auto node = init(solver, chain);
+  EXPECT_EQ(solver.getModelBuildCount(), 1u);
+
+  setStartState(solver, positions);
+  const ctrl::VectorND initial = step(solver, net_force, period);
+  EXPECT_EQ(solver.getModelBuildCount(), 1u);
+
+  // Setting the same value keeps the model
+  ASSERT_TRUE(node->set_parameter(rclcpp::Parameter(link_mass, 0.1)).successful);
+  setStartState(solver, positions);
+  EXPECT_TRUE(step(solver, net_force, period).isApprox(initial));
+  EXPECT_EQ(solver.getModelBuildCount(), 1u);
+
+  // A new value rebuilds it once
+  ASSERT_TRUE(node->set_parameter(rclcpp::Parameter(link_mass, 0.5)).successful);
+  setStartState(solver, positions);
+  const ctrl::VectorND heavier = accelerationsFromRest(step(solver, net_force, period));
+  EXPECT_EQ(solver.getModelBuildCount(), 2u);
+  const ctrl::VectorND reference = referenceAccelerations(chain, 0.5, positions, net_force);
+  EXPECT_LT((heavier - reference).norm(), 1e-6 * reference.norm());
+
+  step(solver, net_force, period);
+  EXPECT_EQ(solver.getModelBuildCount(), 2u);
+
+  // Invalid values are rejected and keep the model
+  EXPECT_FALSE(node->set_parameter(rclcpp::Parameter(link_mass, -1.0)).successful);
+  step(solver, net_force, period);
+  EXPECT_EQ(solver.getModelBuildCount(), 2u);
+}
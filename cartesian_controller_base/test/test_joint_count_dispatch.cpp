@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    test_joint_count_dispatch.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include "ik_solver_fixture.h"
+#include "random_chain.h"
+#include <cartesian_controller_base/DampedLeastSquaresSolver.h>
+#include <cartesian_controller_base/ForwardDynamicsSolver.h>
+#include <cartesian_controller_base/JacobianTransposeSolver.h>
+#include <cartesian_controller_base/JointCountDispatch.h>
+#include <cartesian_controller_base/SelectivelyDampedLeastSquaresSolver.h>
+#include <ostream>
+#include <random>
+#include <tuple>
+
+using cartesian_controller_base::IKSolver;
+using cartesian_controller_base::enableFixedSizeKernels;
+using cartesian_controller_base::test::randomChain;
+using cartesian_controller_base::test::randomPositions;
+
+namespace
+{
+
+//! Creates one kind of solver that dispatches on the number of joints
+struct SolverFactory
+{
+  const char* name;
+  std::shared_ptr<IKSolver> (*create)();
+};
+
+template <class Solver>
+SolverFactory factory(const char* name)
+{
+  return {name, []() -> std::shared_ptr<IKSolver> { return std::make_shared<Solver>(); }};
+}
+
+void PrintTo(const SolverFactory& factory, std::ostream* os)
+{
+  *os << factory.name;
+}
+
+} // namespace
+
+/**
+ * @brief Compare the fixed-size kernels with the dynamically sized ones
+ *
+ * Both solvers start in the same state and get the same forces for a few
+ * control cycles.  Chains with other than 6 or 7 joints take the dynamic path
+ * in both solvers, which checks that disabling the fixed-size kernels has no
+ * side effects.
+ */
+class JointCountDispatchTest
+  : public cartesian_controller_base::test::IKSolverTest
+  , public ::testing::WithParamInterface<std::tuple<SolverFactory, int> >
+{
+  protected:
+    void TearDown() override { enableFixedSizeKernels(true); }
+};
+
+TEST_P(JointCountDispatchTest, FixedSizeKernelsMatchDynamicPath)
+{
+  const SolverFactory factory = std::get<0>(GetParam());
+  const unsigned int joints = std::get<1>(GetParam());
+  std::mt19937 rng(joints);
+  for (int trial = 0; trial < 10; ++trial)
+  {
+    const KDL::Chain chain = randomChain(joints, rng);
+    const KDL::JntArray positions = randomPositions(chain, rng);
+
+    enableFixedSizeKernels(true);
+    std::shared_ptr<IKSolver> fixed_size = factory.create();
+    init(*fixed_size, chain);
+    setStartState(*fixed_size, positions);
+
+    enableFixedSizeKernels(false);
+    std::shared_ptr<IKSolver> dynamic = factory.create();
+    init(*dynamic, chain);
+    setStartState(*dynamic, positions);
+
+    for (int cycle = 0; cycle < 5; ++cycle)
+    {
+      const ctrl::Vector6D net_force = ctrl::Vector6D::Random();
+      const ctrl::VectorND expected = step(*dynamic, net_force, 0.01);
+      const ctrl::VectorND velocities = step(*fixed_size, net_force, 0.01);
+      ASSERT_EQ(velocities.size(), expected.size());
+      EXPECT_LT((velocities - expected).norm(), 1e-12 * (1.0 + expected.norm()))
+        << "trial " << trial << ", cycle " << cycle;
+    }
+    EXPECT_LT((fixed_size->getPositions().data - dynamic->getPositions().data).norm(), 1e-12);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  Solvers,
+  JointCountDispatchTest,
+  ::testing::Combine(
+    ::testing::Values(factory<cartesian_controller_base::ForwardDynamicsSolver>("ForwardDynamics"),
+                      factory<cartesian_controller_base::JacobianTransposeSolver>("JacobianTranspose"),
+                      factory<cartesian_controller_base::DampedLeastSquaresSolver>("DampedLeastSquares"),
+                      factory<cartesian_controller_base::SelectivelyDampedLeastSquaresSolver>(
+                        "SelectivelyDampedLeastSquares")),
+    ::testing::Values(6, 7, 8, 12)));
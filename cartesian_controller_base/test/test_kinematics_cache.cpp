@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    test_kinematics_cache.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include "random_chain.h"
+#include <cartesian_controller_base/KinematicsCache.h>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using cartesian_controller_base::KinematicsCache;
+using cartesian_controller_base::test::randomChain;
+using cartesian_controller_base::test::randomPositions;
+
+namespace
+{
+
+// Link poses by multiplying the segments' poses, index 0 is the root
+std::vector<KDL::Frame> referenceFrames(const KDL::Chain& chain, const KDL::JntArray& positions)
+{
+  std::vector<KDL::Frame> frames(1, KDL::Frame::Identity());
+  unsigned int joint = 0;
+  for (const KDL::Segment& segment : chain.segments)
+  {
+    const bool moving = segment.getJoint().getType() != KDL::Joint::None;
+    frames.push_back(frames.back() * segment.pose(moving ? positions(joint++) : 0.0));
+  }
+  return frames;
+}
+
+void expectNear(const KDL::Frame& a, const KDL::Frame& b, double tolerance)
+{
+  for (int i = 0; i < 3; ++i)
+  {
+    EXPECT_NEAR(a.p(i), b.p(i), tolerance);
+    for (int j = 0; j < 3; ++j)
+    {
+      EXPECT_NEAR(a.M(i, j), b.M(i, j), tolerance);
+    }
+  }
+}
+
+} // namespace
+
+TEST(KinematicsCache, CollapsedChainKeepsAllLinks)
+{
+  std::mt19937 rng(1);
+  for (int trial = 0; trial < 20; ++trial)
+  {
+    const KDL::Chain chain = randomChain(3 + trial % 8, rng);
+    KDL::Chain collapsed;
+    const std::vector<cartesian_controller_base::CollapsedSegment> mapping =
+      cartesian_controller_base::collapseFixedSegments(chain, collapsed);
+
+    ASSERT_EQ(mapping.size(), chain.getNrOfSegments());
+    EXPECT_EQ(collapsed.getNrOfJoints(), chain.getNrOfJoints());
+    const bool leading_fixed = chain.getSegment(0).getJoint().getType() == KDL::Joint::None;
+    EXPECT_EQ(collapsed.getNrOfSegments(), chain.getNrOfJoints() + (leading_fixed ? 1 : 0));
+
+    // Each original link is its collapsed segment's tip times the offset
+    const KDL::JntArray positions = randomPositions(chain, rng);
+    const std::vector<KDL::Frame> original = referenceFrames(chain, positions);
+    const std::vector<KDL::Frame> merged = referenceFrames(collapsed, positions);
+    for (size_t s = 0; s < mapping.size(); ++s)
+    {
+      expectNear(merged[mapping[s].segment + 1] * mapping[s].offset, original[s + 1], 1e-12);
+    }
+  }
+}
+
+TEST(KinematicsCache, FramesMatchSegmentPoses)
+{
+  std::mt19937 rng(2);
+  for (int trial = 0; trial < 20; ++trial)
+  {
+    const KDL::Chain chain = randomChain(3 + trial % 13, rng);
+    KinematicsCache cache;
+    cache.init(chain);
+    ASSERT_EQ(cache.getNrOfFrames(), static_cast<int>(chain.getNrOfSegments()) + 1);
+
+    const KDL::JntArray positions = randomPositions(chain, rng);
+    EXPECT_TRUE(cache.update(positions));
+    EXPECT_FALSE(cache.update(positions));
+    cache.invalidate();
+    EXPECT_TRUE(cache.update(positions));
+
+    const std::vector<KDL::Frame> reference = referenceFrames(chain, positions);
+    for (int i = 0; i < cache.getNrOfFrames(); ++i)
+    {
+      expectNear(cache.getFrame(i), reference[i], 1e-12);
+    }
+    expectNear(cache.getTipFrame(), reference.back(), 1e-12);
+  }
+}
+
+TEST(KinematicsCache, JacobianMatchesFiniteDifferences)
+{
+  std::mt19937 rng(3);
+  for (int trial = 0; trial < 20; ++trial)
+  {
+    const KDL::Chain chain = randomChain(3 + trial % 13, rng);
+    KinematicsCache cache;
+    cache.init(chain);
+
+    // Move the TCP to a random link with an offset
+    const int tool = std::uniform_int_distribution<int>(0, cache.getNrOfFrames() - 1)(rng);
+    const KDL::Frame offset(KDL::Rotation::RotX(0.3), KDL::Vector(0.05, -0.1, 0.2));
+    cache.setTool(tool, offset);
+    EXPECT_EQ(cache.getToolIndex(), tool);
+
+    const KDL::JntArray positions = randomPositions(chain, rng);
+    cache.update(positions);
+    const KDL::Jacobian jacobian = cache.getJacobian();
+    const KDL::Frame tip = cache.getTipFrame();
+    expectNear(tip, cache.getFrame(tool) * offset, 1e-12);
+
+    const double h = 1e-6;
+    for (unsigned int j = 0; j < chain.getNrOfJoints(); ++j)
+    {
+      KDL::JntArray q = positions;
+      q(j) = positions(j) + h;
+      cache.update(q);
+      const KDL::Frame plus = cache.getTipFrame();
+      q(j) = positions(j) - h;
+      cache.update(q);
+      const KDL::Frame minus = cache.getTipFrame();
+
+      const KDL::Vector linear = (plus.p - minus.p) / (2.0 * h);
+      const KDL::Vector angular = (plus.M * minus.M.Inverse()).GetRot() / (2.0 * h);
+      for (int i = 0; i < 3; ++i)
+      {
+        EXPECT_NEAR(jacobian(i, j), linear(i), 1e-6);
+        EXPECT_NEAR(jacobian(i + 3, j), angular(i), 1e-6);
+      }
+    }
+  }
+}
+
+TEST(KinematicsCache, UnknownLinkHasNoIndex)
+{
+  std::mt19937 rng(4);
+  KinematicsCache cache;
+  cache.init(randomChain(4, rng));
+  EXPECT_EQ(cache.linkIndex("link_0"), 1);
+  EXPECT_EQ(cache.linkIndex("no_such_link"), -1);
+}
@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    test_selectively_damped_least_squares_solver.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include "ik_solver_fixture.h"
+#include "random_chain.h"
+#include <Eigen/SVD>
+#include <algorithm>
+#include <cartesian_controller_base/SelectivelyDampedLeastSquaresSolver.h>
+#include <kdl/chainjnttojacsolver.hpp>
+#include <random>
+
+using cartesian_controller_base::SelectivelyDampedLeastSquaresSolver;
+using cartesian_controller_base::test::randomChain;
+using cartesian_controller_base::test::randomPositions;
+
+namespace
+{
+
+ctrl::VectorND clampMaxAbs(const ctrl::VectorND& w, double d)
+{
+  const double max = w.cwiseAbs().maxCoeff();
+  return max <= d ? w : ctrl::VectorND(d * w / max);
+}
+
+/**
+ * @brief Joint velocities of the SDLS method with a full SVD of the Jacobian
+ *
+ * This is the solver's previous implementation, but iterates over the
+ * min(6, n) singular values instead of the n joints.  Like the solver, it
+ * skips singular values below 1e-6 of the largest one.  Their directions
+ * would otherwise receive an arbitrary motion of up to the maximum clamping
+ * value, e.g. at wrist singularities.
+ */
+ctrl::VectorND referenceVelocities(const KDL::Chain& chain,
+                                   const KDL::JntArray& positions,
+                                   const ctrl::Vector6D& net_force)
+{
+  const int joints = chain.getNrOfJoints();
+  KDL::Jacobian jacobian(joints);
+  KDL::ChainJntToJacSolver(chain).JntToJac(positions, jacobian);
+
+  Eigen::JacobiSVD<Eigen::Matrix<double, 6, Eigen::Dynamic> > svd(
+    jacobian.data, Eigen::ComputeFullU | Eigen::ComputeFullV);
+  const ctrl::Matrix6D U = svd.matrixU();
+  const ctrl::MatrixND V = svd.matrixV();
+  const ctrl::VectorND s = svd.singularValues();
+
+  const double gamma_max = 3.141592653 / 4;
+  ctrl::VectorND sum_phi = ctrl::VectorND::Zero(joints);
+  for (int i = 0; i < s.size(); ++i)
+  {
+    if (s[i] <= 1e-6 * s[0])
+    {
+      break;
+    }
+    const double alpha = U.col(i).dot(net_force);
+    const double N = U.col(i).head(3).norm();
+    double M = 0;
+    for (int j = 0; j < joints; ++j)
+    {
+      M += std::abs(V.col(i)[j]) * jacobian.data.col(j).head(3).norm();
+    }
+    M *= 1.0 / s[i];
+    const double gamma = std::min(1.0, N / M) * gamma_max;
+    sum_phi += clampMaxAbs(1.0 / s[i] * alpha * V.col(i), gamma);
+  }
+  return clampMaxAbs(sum_phi, gamma_max);
+}
+
+/**
+ * @brief An arm with a spherical wrist
+ *
+ * Its wrist is singular if the fifth joint is at zero, since the fourth and
+ * sixth joint axes align.
+ */
+KDL::Chain wristChain()
+{
+  const KDL::Joint::JointType axes[] = {
+    KDL::Joint::RotZ, KDL::Joint::RotY, KDL::Joint::RotY,
+    KDL::Joint::RotZ, KDL::Joint::RotY, KDL::Joint::RotZ};
+  const double lengths[] = {0.3, 0.4, 0.35, 0.1, 0.1, 0.05};
+
+  KDL::Chain chain;
+  for (int i = 0; i < 6; ++i)
+  {
+    chain.addSegment(KDL::Segment("link_" + std::to_string(i),
+                                  KDL::Joint("joint_" + std::to_string(i), axes[i]),
+                                  KDL::Frame(KDL::Vector(0.0, 0.0, lengths[i]))));
+  }
+  return chain;
+}
+
+} // namespace
+
+class SelectivelyDampedLeastSquaresSolverTest
+  : public cartesian_controller_base::test::IKSolverTest
+  , public ::testing::WithParamInterface<int>
+{
+};
+
+TEST_P(SelectivelyDampedLeastSquaresSolverTest, MatchesSingularValueDecomposition)
+{
+  const unsigned int joints = GetParam();
+  std::mt19937 rng(joints);
+  for (int trial = 0; trial < 20; ++trial)
+  {
+    const KDL::Chain chain = randomChain(joints, rng);
+    const KDL::JntArray positions = randomPositions(chain, rng);
+
+    SelectivelyDampedLeastSquaresSolver solver;
+    auto node = init(solver, chain);
+    setStartState(solver, positions);
+
+    const ctrl::Vector6D net_force = ctrl::Vector6D::Random();
+    const ctrl::VectorND velocities = step(solver, net_force, 0.01);
+    const ctrl::VectorND reference = referenceVelocities(chain, positions, net_force);
+    ASSERT_EQ(velocities.size(), reference.size());
+    EXPECT_LT((velocities - reference).norm(), 1e-9 * reference.norm());
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(JointCounts, SelectivelyDampedLeastSquaresSolverTest, ::testing::Values(1, 3, 5, 6, 7, 9, 15));
+
+TEST_F(SelectivelyDampedLeastSquaresSolverTest, MatchesSingularValueDecompositionNearSingularities)
+{
+  const KDL::Chain chain = wristChain();
+  std::mt19937 rng(1);
+  for (double wrist : {1e-2, 1e-3, 1e-4, 1e-9, 0.0})
+  {
+    for (int trial = 0; trial < 10; ++trial)
+    {
+      KDL::JntArray positions = randomPositions(chain, rng);
+      positions(4) = wrist;
+
+      SelectivelyDampedLeastSquaresSolver solver;
+      auto node = init(solver, chain);
+      setStartState(solver, positions);
+
+      const ctrl::Vector6D net_force = ctrl::Vector6D::Random();
+      const ctrl::VectorND velocities = step(solver, net_force, 0.01);
+      const ctrl::VectorND reference = referenceVelocities(chain, positions, net_force);
+      ASSERT_TRUE(velocities.allFinite());
+
+      // Decomposing J J^T squares the condition number
+      EXPECT_LT((velocities - reference).norm(), 1e-5 * reference.norm()) << "wrist at " << wrist;
+    }
+  }
+}
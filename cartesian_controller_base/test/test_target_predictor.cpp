@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    test_target_predictor.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <cartesian_controller_base/core/TargetPredictor.h>
+#include <gtest/gtest.h>
+
+using cartesian_controller_base::core::TargetPredictor;
+
+namespace
+{
+
+const int64_t MS = 1000000;  // nanoseconds
+
+// Target with constant linear and angular velocity
+KDL::Frame target(double time)
+{
+  return KDL::Frame(KDL::Rotation::RotZ(0.5 * time), KDL::Vector(0.1 + 0.2 * time, -0.3 * time, 0.4));
+}
+
+} // namespace
+
+TEST(TargetPredictor, EstimatesConstantVelocities)
+{
+  TargetPredictor predictor;
+  predictor.init(5);
+  for (int i = 0; i < 10; ++i)
+  {
+    // Jitter doesn't matter for exact samples
+    const int64_t stamp = i * 10 * MS + (i % 3) * MS;
+    ASSERT_TRUE(predictor.add(stamp, target(stamp * 1e-9)));
+  }
+
+  const TargetPredictor::Prediction& prediction = predictor.prediction();
+  EXPECT_NEAR(prediction.linear_velocity.x(), 0.2, 1e-9);
+  EXPECT_NEAR(prediction.linear_velocity.y(), -0.3, 1e-9);
+  EXPECT_NEAR(prediction.linear_velocity.z(), 0.0, 1e-9);
+  EXPECT_NEAR(prediction.angular_velocity.x(), 0.0, 1e-9);
+  EXPECT_NEAR(prediction.angular_velocity.y(), 0.0, 1e-9);
+  EXPECT_NEAR(prediction.angular_velocity.z(), 0.5, 1e-9);
+
+  // Extrapolate to the true target
+  const int64_t time = prediction.stamp + 20 * MS;
+  const KDL::Frame extrapolated = TargetPredictor::extrapolate(prediction, time, 0.1);
+  const KDL::Frame expected = target(time * 1e-9);
+  EXPECT_NEAR((extrapolated.p - expected.p).Norm(), 0.0, 1e-9);
+  EXPECT_NEAR((extrapolated.M * expected.M.Inverse()).GetRot().Norm(), 0.0, 1e-9);
+}
+
+TEST(TargetPredictor, LimitsTheHorizon)
+{
+  TargetPredictor predictor;
+  predictor.init(2);
+  predictor.add(0, target(0.0));
+  predictor.add(10 * MS, target(0.01));
+  const TargetPredictor::Prediction& prediction = predictor.prediction();
+
+  const KDL::Frame limited = TargetPredictor::extrapolate(prediction, prediction.stamp + 1000 * MS, 0.05);
+  EXPECT_NEAR((limited.p - target(0.06).p).Norm(), 0.0, 1e-9);
+
+  // No extrapolation into the past or without horizon
+  EXPECT_EQ(TargetPredictor::extrapolate(prediction, prediction.stamp - 5 * MS, 0.05).p, prediction.pose.p);
+  EXPECT_EQ(TargetPredictor::extrapolate(prediction, prediction.stamp + 5 * MS, 0.0).p, prediction.pose.p);
+}
+
+TEST(TargetPredictor, RejectsOutdatedSamples)
+{
+  TargetPredictor predictor;
+  predictor.init(3);
+  EXPECT_TRUE(predictor.add(10 * MS, target(0.01)));
+  EXPECT_FALSE(predictor.add(10 * MS, target(0.02)));
+  EXPECT_FALSE(predictor.add(5 * MS, target(0.02)));
+  EXPECT_EQ(predictor.prediction().stamp, 10 * MS);
+  EXPECT_EQ(predictor.prediction().linear_velocity.Norm(), 0.0);
+
+  // Starts afresh after a reset
+  predictor.reset();
+  EXPECT_TRUE(predictor.add(5 * MS, target(0.005)));
+}
+
+TEST(TargetPredictor, IgnoresSamplesBeforePauses)
+{
+  TargetPredictor predictor;
+  predictor.init(5, 0.1);
+
+  // A moving target, then a pause and a target at rest
+  predictor.add(0, target(0.0));
+  predictor.add(10 * MS, target(0.01));
+  predictor.add(1000 * MS, target(0.02));
+  EXPECT_EQ(predictor.prediction().linear_velocity.Norm(), 0.0);
+  predictor.add(1010 * MS, target(0.02));
+  EXPECT_EQ(predictor.prediction().linear_velocity.Norm(), 0.0);
+  EXPECT_EQ(predictor.prediction().angular_velocity.Norm(), 0.0);
+}
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+//-----------------------------------------------------------------------------
+/*!\file    test_triple_buffer.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+#include <cartesian_controller_base/TripleBuffer.h>
+#include <gtest/gtest.h>
+#include <array>
+#include <thread>
+
+using cartesian_controller_base::TripleBuffer;
+
+TEST(TripleBuffer, StartsEmpty)
+{
+  TripleBuffer<int> buffer;
+  EXPECT_FALSE(buffer.read());
+  EXPECT_EQ(buffer.latest().sequence, 0u);
+  EXPECT_EQ(buffer.latest().data, 0);
+}
+
+TEST(TripleBuffer, HandsOverTheMostRecentSample)
+{
+  TripleBuffer<int> buffer;
+  buffer.write(1, rclcpp::Time(10));
+  buffer.write(2, rclcpp::Time(20));
+  ASSERT_TRUE(buffer.read());
+  EXPECT_EQ(buffer.latest().data, 2);
+  EXPECT_EQ(buffer.latest().sequence, 2u);
+  EXPECT_EQ(buffer.latest().stamp.nanoseconds(), 20);
+
+  // Nothing new, the last sample stays
+  EXPECT_FALSE(buffer.read());
+  EXPECT_EQ(buffer.latest().data, 2);
+
+  buffer.write(3, rclcpp::Time(30));
+  EXPECT_EQ(buffer.latest().data, 2);  // stable until the next read
+  ASSERT_TRUE(buffer.read());
+  EXPECT_EQ(buffer.latest().data, 3);
+}
+
+TEST(TripleBuffer, NeverTearsSamples)
+{
+  // Samples are consistent if all entries are equal
+  using Sample = std::array<uint64_t, 64>;
+  TripleBuffer<Sample> buffer;
+  const uint64_t count = 100000;
+
+  std::thread producer([&]() {
+    Sample sample;
+    for (uint64_t i = 1; i <= count; ++i)
+    {
+      sample.fill(i);
+      buffer.write(sample, rclcpp::Time(0));
+    }
+  });
+
+  uint64_t last = 0;
+  while (last < count)
+  {
+    if (!buffer.read())
+    {
+      continue;
+    }
+    const TripleBuffer<Sample>::Sample& latest = buffer.latest();
+    ASSERT_GT(latest.sequence, last);
+    ASSERT_EQ(latest.data.front(), latest.sequence);
+    for (uint64_t entry : latest.data)
+    {
+      ASSERT_EQ(entry, latest.sequence);
+    }
+    last = latest.sequence;
+  }
+  producer.join();
+}
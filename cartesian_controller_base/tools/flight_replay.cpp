@@ -0,0 +1,672 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright 2026 FZI Research Center for Information Technology
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+// contributors may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
+/*!\file    flight_replay.cpp
+ *
+ * \author  Stefan Scherzinger <scherzin@fzi.de>
+ * \date    2026/10/16
+ *
+ */
+//-----------------------------------------------------------------------------
+
+/**
+ * Replay a flight recording offline through a controller's error computation
+ * and an IK solver plugin.
+ *
+ * This needs neither a controller_manager nor a robot.  The recorded joint
+ * positions, target poses and wrenches of each cycle are fed into the same
+ * building blocks that the motion, force and compliance controllers use.  The
+ * cycles run back to back, i.e. much faster than real time, and without
+ * measuring time.  Time budgets are therefore ignored.  The output only
+ * depends on the recording, the parameters and the build, which makes it
+ * suitable for regression tests, parameter sweeps, and profiling.
+ *
+ * Use the controller's configuration with the node renamed accordingly:
+ * \code{.sh}
+ * ros2 run cartesian_controller_base flight_replay compliance \
+ *   /tmp/my_cartesian_compliance_controller.flight replay.txt \
+ *   --ros-args -r __node:=my_cartesian_compliance_controller \
+ *   --params-file controller_manager.yaml \
+ *   -p robot_description:="$(xacro robot.urdf.xacro)"
+ * \endcode
+ *
+ * Each output line holds one cycle: the sample's sequence number, the number
+ * of solver iterations, the Cartesian input, and the simulated joint positions
+ * and velocities.  Values are printed with 17 significant digits, so that
+ * identical runs give identical files.  A summary goes to stderr.
+ *
+ * Activations, including their start velocities from a hot standby, and
+ * switches of the tool center point are replayed as recorded.  The replay
+ * stops at dropped samples and at robot model swaps, because the state they
+ * would need is not in the recording.
+ */
+
+#include "ROS2VersionConfig.h"
+#include <cartesian_controller_base/FlightLog.h>
+#include <cartesian_controller_base/IKSolver.h>
+#include <cartesian_controller_base/RobotModel.h>
+#include <cartesian_controller_base/SpatialPDController.h>
+#include <cartesian_controller_base/Utility.h>
+#include <cartesian_controller_base/core/CartesianMath.h>
+#include <cartesian_controller_base/core/CommandExtrapolator.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <hardware_interface/handle.hpp>
+#include <hardware_interface/loaned_state_interface.hpp>
+#include <hardware_interface/types/hardware_interface_type_values.hpp>
+#include <kdl/chain.hpp>
+#include <kdl/frames.hpp>
+#include <kdl/jntarray.hpp>
+#include <memory>
+#include <pluginlib/class_loader.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <trajectory_msgs/msg/joint_trajectory_point.hpp>
+#include <vector>
+
+namespace
+{
+
+using cartesian_controller_base::FlightLog;
+using cartesian_controller_base::FlightRecorder;
+using cartesian_controller_base::IKSolver;
+
+#if defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
+using NodeType = rclcpp_lifecycle::LifecycleNode;
+#else
+using NodeType = rclcpp::Node;
+#endif
+
+//! The controller whose error computation is replayed
+enum class Mode
+{
+  MOTION,
+  FORCE,
+  COMPLIANCE
+};
+
+/**
+ * @brief Declare a parameter with the controllers' default
+ *
+ * Values from the command line or parameter files take precedence.
+ */
+template <class T>
+T declare(NodeType& node, const std::string& name, const T& default_value)
+{
+  if (!node.has_parameter(name))
+  {
+    return node.declare_parameter<T>(name, default_value);
+  }
+  return node.get_parameter(name).get_value<T>();
+}
+
+/**
+ * @brief The controllers' control cycle without ROS communication
+ *
+ * Mirrors the \a update() of the Cartesian controllers and the solver
+ * iteration of the \ref cartesian_controller_base::CartesianControllerBase.
+ */
+class Replay
+{
+  public:
+    /**
+     * @brief Set up the solver and the error computation from the node's parameters
+     *
+     * @param node Holds the controller's parameters
+     * @param mode The error computation to replay
+     *
+     * @return True on success
+     */
+    bool init(std::shared_ptr<NodeType> node, Mode mode)
+    {
+      m_mode = mode;
+      const auto logger = node->get_logger();
+
+      // Same parameters and defaults as the controllers
+      const std::string ik_solver = declare<std::string>(*node, "ik_solver", "forward_dynamics");
+      const std::string robot_description = declare<std::string>(*node, "robot_description", "");
+      m_robot_base_link = declare<std::string>(*node, "robot_base_link", "");
+      const std::string end_effector_link = declare<std::string>(*node, "end_effector_link", "");
+      m_joint_names = declare<std::vector<std::string>>(*node, "joints", {});
+      m_error_scale = declare<double>(*node, "solver.error_scale", 1.0);
+      m_iterations = declare<int>(*node, "solver.iterations", 1);
+      m_error_threshold = declare<double>(*node, "solver.convergence.error_threshold", 0.0);
+      m_velocity_threshold = declare<double>(*node, "solver.convergence.velocity_threshold", 0.0);
+      m_decimation = declare<int>(*node, "solver.decimation", 1);
+      m_interpolation_order = declare<int>(*node, "solver.interpolation_order", 1);
+      m_force_parameters.hand_frame_control = declare<bool>(*node, "hand_frame_control", true);
+      const std::string compliance_ref_link = declare<std::string>(*node, "compliance_ref_link", "");
+      const char* stiffness[] = {"trans_x", "trans_y", "trans_z", "rot_x", "rot_y", "rot_z"};
+      for (int i = 0; i < 6; ++i)
+      {
+        m_compliance_parameters.stiffness[i] =
+          declare<double>(*node, std::string("stiffness.") + stiffness[i], i < 3 ? 500.0 : 50.0);
+      }
+
+      if (robot_description.empty() || m_robot_base_link.empty() || end_effector_link.empty() ||
+          m_joint_names.empty())
+      {
+        RCLCPP_ERROR(logger, "Need robot_description, robot_base_link, end_effector_link, and joints");
+        return false;
+      }
+      if (m_decimation < 1 || m_interpolation_order < 0 ||
+          m_interpolation_order > cartesian_controller_base::core::CommandExtrapolator::MAX_ORDER)
+      {
+        RCLCPP_ERROR(logger, "Need solver.decimation >= 1 and solver.interpolation_order in [0, %d]",
+                     cartesian_controller_base::core::CommandExtrapolator::MAX_ORDER);
+        return false;
+      }
+
+      KDL::JntArray upper_pos_limits;
+      KDL::JntArray lower_pos_limits;
+      std::string error;
+      if (!cartesian_controller_base::parseRobotModel(robot_description,
+                                                      m_robot_base_link,
+                                                      end_effector_link,
+                                                      m_joint_names,
+                                                      m_robot_chain,
+                                                      upper_pos_limits,
+                                                      lower_pos_limits,
+                                                      error))
+      {
+        RCLCPP_ERROR(logger, error.c_str());
+        return false;
+      }
+
+      m_solver_loader = std::make_shared<pluginlib::ClassLoader<IKSolver> >(
+        "cartesian_controller_base", "cartesian_controller_base::IKSolver");
+      try
+      {
+        m_ik_solver = m_solver_loader->createSharedInstance(ik_solver);
+      }
+      catch (pluginlib::PluginlibException& ex)
+      {
+        RCLCPP_ERROR(logger, ex.what());
+        return false;
+      }
+      if (!m_ik_solver->init(node, m_robot_chain, upper_pos_limits, lower_pos_limits))
+      {
+        RCLCPP_ERROR(logger, "Failed to initialize the IK solver %s", ik_solver.c_str());
+        return false;
+      }
+      if (!m_spatial_controller.init(node))
+      {
+        RCLCPP_ERROR(logger, "Failed to initialize the PD gains");
+        return false;
+      }
+
+      m_simulated_joint_motion.positions.resize(m_robot_chain.getNrOfJoints());
+      m_simulated_joint_motion.velocities.resize(m_robot_chain.getNrOfJoints());
+      m_extrapolator.init(upper_pos_limits, lower_pos_limits);
+      m_start_positions.resize(m_robot_chain.getNrOfJoints());
+      m_start_velocities.resize(m_robot_chain.getNrOfJoints());
+
+      // Sensor wrenches are recorded in the controller's reference frame
+      m_end_effector_index = linkIndex(end_effector_link);
+      m_compliance_ref_index = linkIndex(compliance_ref_link);
+      m_ft_sensor_ref_index = m_mode == Mode::COMPLIANCE ? m_compliance_ref_index : m_end_effector_index;
+      if (m_mode == Mode::COMPLIANCE && m_compliance_ref_index < 0)
+      {
+        RCLCPP_ERROR(logger, "compliance_ref_link %s is not part of the robot chain", compliance_ref_link.c_str());
+        return false;
+      }
+
+      // Joint state interfaces on local buffers
+      m_joint_positions.assign(m_joint_names.size(), 0.0);
+      m_state_interfaces.reserve(m_joint_names.size());
+      m_loaned_state_interfaces.reserve(m_joint_names.size());
+      for (size_t i = 0; i < m_joint_names.size(); ++i)
+      {
+        m_state_interfaces.emplace_back(
+          m_joint_names[i], hardware_interface::HW_IF_POSITION, &m_joint_positions[i]);
+        m_loaned_state_interfaces.emplace_back(m_state_interfaces.back());
+        m_joint_state_pos_handles.emplace_back(m_loaned_state_interfaces.back());
+      }
+      return true;
+    }
+
+    //! The number of joints
+    size_t numberJoints() const { return m_joint_names.size(); }
+
+    /**
+     * @brief Start from the given record as the controllers do on activation
+     *
+     * @param log The recording
+     * @param record The record with the starting joint positions and velocities
+     */
+    void start(const FlightLog& log, size_t record)
+    {
+      readJointPositions(log, record);
+      const double* start_velocities = log.field(record, FlightRecorder::START_VELOCITIES);
+      for (size_t i = 0; i < m_joint_positions.size(); ++i)
+      {
+        m_start_positions(i) = m_joint_positions[i];
+        m_start_velocities(i) = start_velocities[i];
+      }
+      m_ik_solver->core().setStartState(m_start_positions, m_start_velocities);
+      applyToolFrame(log, record);
+      m_ik_solver->updateKinematics();
+      m_target_frame = m_ik_solver->getEndEffectorPose();
+      m_target_wrench.setZero();
+      m_ft_sensor_wrench.setZero();
+      computeJointControlCmds(ctrl::Vector6D::Zero(), rclcpp::Duration::from_seconds(0));
+      m_extrapolator.reset(m_simulated_joint_motion.positions, m_simulated_joint_motion.velocities);
+      m_decimation_counter = 0;
+      m_last_iterations = 0;
+    }
+
+    /**
+     * @brief Replay the given record as one control cycle
+     *
+     * @param log The recording
+     * @param record The record with the cycle's inputs
+     */
+    void update(const FlightLog& log, size_t record)
+    {
+      // Synchronize the internal model and the recorded robot
+      readJointPositions(log, record);
+      m_ik_solver->synchronizeJointPositions(m_joint_state_pos_handles);
+      if (log.event(record, FlightRecorder::TOOL_SWITCH))
+      {
+        applyToolFrame(log, record);
+      }
+
+      // Recorded inputs
+      m_target_frame = frame(log.field(record, FlightRecorder::TARGET_FRAME));
+      const double* target_wrench = log.field(record, FlightRecorder::TARGET_WRENCH);
+      const double* ft_sensor_wrench = log.field(record, FlightRecorder::SENSOR_WRENCH);
+      for (int i = 0; i < 6; ++i)
+      {
+        m_target_wrench[i] = target_wrench[i];
+        m_ft_sensor_wrench[i] = ft_sensor_wrench[i];
+      }
+
+      // Decimated solver cycles as in the controllers
+      const int step = m_decimation_counter;
+      m_decimation_counter = (m_decimation_counter + 1) % m_decimation;
+      if (step != 0)
+      {
+        m_extrapolator.extrapolate(m_interpolation_order,
+                                   static_cast<double>(step) / m_decimation,
+                                   m_simulated_joint_motion.positions,
+                                   m_simulated_joint_motion.velocities);
+        m_last_iterations = 0;
+        return;
+      }
+
+      // The controllers' internal simulation period
+      const auto internal_period = rclcpp::Duration::from_seconds(0.02);
+
+      if (m_mode == Mode::FORCE)
+      {
+        computeJointControlCmds(computeForceError(), internal_period);
+        m_last_iterations = 1;
+      }
+      else
+      {
+        int iterations = 0;
+        bool converged = false;
+        while (iterations < m_iterations && !converged)
+        {
+          const ctrl::Vector6D error = computeError();
+          computeJointControlCmds(error, internal_period);
+          converged = hasConverged(error);
+          ++iterations;
+        }
+        m_last_iterations = iterations;
+      }
+      if (m_decimation > 1)
+      {
+        m_extrapolator.push(m_simulated_joint_motion.positions, m_simulated_joint_motion.velocities);
+      }
+    }
+
+    int lastIterations() const { return m_last_iterations; }
+
+    const ctrl::Vector6D& cartesianInput() const { return m_cartesian_input; }
+
+    const trajectory_msgs::msg::JointTrajectoryPoint& simulatedJointMotion() const
+    {
+      return m_simulated_joint_motion;
+    }
+
+    const std::vector<std::string>& jointNames() const { return m_joint_names; }
+
+  private:
+    void readJointPositions(const FlightLog& log, size_t record)
+    {
+      const double* positions = log.field(record, FlightRecorder::JOINT_POSITIONS);
+      for (size_t i = 0; i < m_joint_positions.size(); ++i)
+      {
+        m_joint_positions[i] = positions[i];
+      }
+    }
+
+    //! A pose as x, y, z, qx, qy, qz, qw
+    static KDL::Frame frame(const double* pose)
+    {
+      return KDL::Frame(KDL::Rotation::Quaternion(pose[3], pose[4], pose[5], pose[6]),
+                        KDL::Vector(pose[0], pose[1], pose[2]));
+    }
+
+    //! Switch to the record's tool center point
+    void applyToolFrame(const FlightLog& log, size_t record)
+    {
+      m_ik_solver->core().setToolFrame(static_cast<int>(log.field(record, FlightRecorder::TOOL_LINK)[0]),
+                                       frame(log.field(record, FlightRecorder::TOOL_FRAME)));
+      m_ik_solver->updateKinematics();
+    }
+
+    int linkIndex(const std::string& link)
+    {
+      if (link == m_robot_base_link)
+      {
+        return 0;
+      }
+      return m_ik_solver->getKinematics().linkIndex(link);
+    }
+
+    //! Orientation of the given link in the base frame
+    const KDL::Rotation& rotation(int link)
+    {
+      return m_ik_solver->getKinematics().getFrame(link).M;
+    }
+
+    ctrl::Vector6D computeError()
+    {
+      if (m_mode == Mode::MOTION)
+      {
+        return computeMotionError();
+      }
+      return cartesian_controller_base::core::computeComplianceError(
+        m_compliance_parameters, computeMotionError(), computeForceError(), rotation(m_compliance_ref_index));
+    }
+
+    ctrl::Vector6D computeMotionError()
+    {
+      return cartesian_controller_base::core::computeMotionError(m_target_frame,
+                                                                 m_ik_solver->getEndEffectorPose());
+    }
+
+    ctrl::Vector6D computeForceError()
+    {
+      return cartesian_controller_base::core::computeForceError(
+        m_force_parameters, m_target_wrench, m_ft_sensor_wrench, m_ik_solver->getKinematics().getTipFrame().M,
+#if defined CARTESIAN_CONTROLLERS_GALACTIC || defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
+        rotation(m_ft_sensor_ref_index));
+#elif defined CARTESIAN_CONTROLLERS_FOXY
+        KDL::Rotation::Identity());
+#endif
+    }
+
+    void computeJointControlCmds(const ctrl::Vector6D& error, const rclcpp::Duration& period)
+    {
+      m_cartesian_input = m_error_scale * m_spatial_controller(error, period);
+      m_ik_solver->getJointControlCmds(period, m_cartesian_input, m_simulated_joint_motion);
+      m_ik_solver->updateKinematics();
+    }
+
+    bool hasConverged(const ctrl::Vector6D& error) const
+    {
+      if (error.norm() < m_error_threshold)
+      {
+        return true;
+      }
+
+      double velocity_norm = 0.0;
+      for (const auto& velocity : m_simulated_joint_motion.velocities)
+      {
+        velocity_norm += velocity * velocity;
+      }
+      return std::sqrt(velocity_norm) < m_velocity_threshold;
+    }
+
+    Mode m_mode = {Mode::MOTION};
+
+    std::shared_ptr<pluginlib::ClassLoader<IKSolver> > m_solver_loader;
+    std::shared_ptr<IKSolver> m_ik_solver;
+    cartesian_controller_base::SpatialPDController m_spatial_controller;
+    KDL::Chain m_robot_chain;
+
+    std::string m_robot_base_link;
+    std::vector<std::string> m_joint_names;
+    int m_end_effector_index = {-1};
+    int m_compliance_ref_index = {-1};
+    int m_ft_sensor_ref_index = {-1};
+
+    // Parameters
+    double m_error_scale = {1.0};
+    int m_iterations = {1};
+    double m_error_threshold = {0.0};
+    double m_velocity_threshold = {0.0};
+    int m_decimation = {1};
+    int m_interpolation_order = {1};
+    cartesian_controller_base::core::ForceErrorParameters m_force_parameters;
+    cartesian_controller_base::core::ComplianceErrorParameters m_compliance_parameters;
+
+    // Inputs of the current cycle
+    std::vector<double> m_joint_positions;
+    std::vector<hardware_interface::StateInterface> m_state_interfaces;
+    std::vector<hardware_interface::LoanedStateInterface> m_loaned_state_interfaces;
+    std::vector<std::reference_wrapper<hardware_interface::LoanedStateInterface> >
+      m_joint_state_pos_handles;
+    KDL::JntArray m_start_positions;
+    KDL::JntArray m_start_velocities;
+    KDL::Frame m_target_frame;
+    ctrl::Vector6D m_target_wrench;
+    ctrl::Vector6D m_ft_sensor_wrench;
+
+    // Outputs of the current cycle
+    ctrl::Vector6D m_cartesian_input;
+    trajectory_msgs::msg::JointTrajectoryPoint m_simulated_joint_motion;
+    int m_last_iterations = {0};
+
+    // Decimated solver cycles
+    cartesian_controller_base::core::CommandExtrapolator m_extrapolator;
+    int m_decimation_counter = {0};
+};
+
+void printUsage()
+{
+  std::fprintf(stderr,
+               "Usage: flight_replay {motion|force|compliance} <recording> [<output>] "
+               "--ros-args -r __node:=<controller name> --params-file <config> "
+               "-p robot_description:=<urdf>\n");
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const std::vector<std::string> args = rclcpp::init_and_remove_ros_arguments(argc, argv);
+  if (args.size() < 3 || args.size() > 4)
+  {
+    printUsage();
+    rclcpp::shutdown();
+    return 1;
+  }
+
+  Mode mode;
+  if (args[1] == "motion")
+  {
+    mode = Mode::MOTION;
+  }
+  else if (args[1] == "force")
+  {
+    mode = Mode::FORCE;
+  }
+  else if (args[1] == "compliance")
+  {
+    mode = Mode::COMPLIANCE;
+  }
+  else
+  {
+    printUsage();
+    rclcpp::shutdown();
+    return 1;
+  }
+
+  FlightLog recording;
+  std::string error;
+  if (!recording.open(args[2], error))
+  {
+    std::fprintf(stderr, "%s\n", error.c_str());
+    rclcpp::shutdown();
+    return 1;
+  }
+  if (recording.size() == 0)
+  {
+    std::fprintf(stderr, "%s contains no records\n", args[2].c_str());
+    rclcpp::shutdown();
+    return 1;
+  }
+
+  {
+    auto node = std::make_shared<NodeType>("flight_replay");
+    Replay replay;
+    if (!replay.init(node, mode))
+    {
+      rclcpp::shutdown();
+      return 1;
+    }
+    const size_t number_joints = replay.numberJoints();
+    if (number_joints != recording.header().number_joints)
+    {
+      std::fprintf(stderr, "Recording has %u joints, configuration has %zu\n",
+                   recording.header().number_joints, number_joints);
+      rclcpp::shutdown();
+      return 1;
+    }
+    if (!recording.event(0, FlightRecorder::ACTIVATION))
+    {
+      std::fprintf(stderr,
+                   "Warning: The recording doesn't start with the controller's activation. "
+                   "Replaying from sequence %lu with the last recorded start velocities.\n",
+                   static_cast<unsigned long>(recording.sequence(0)));
+    }
+
+    FILE* out = args.size() == 4 ? std::fopen(args[3].c_str(), "w") : stdout;
+    if (!out)
+    {
+      std::fprintf(stderr, "Failed to open %s\n", args[3].c_str());
+      rclcpp::shutdown();
+      return 1;
+    }
+
+    // Column names
+    std::fprintf(out, "# sequence iterations fx fy fz tx ty tz");
+    for (const auto& joint : replay.jointNames())
+    {
+      std::fprintf(out, " %s/position", joint.c_str());
+    }
+    for (const auto& joint : replay.jointNames())
+    {
+      std::fprintf(out, " %s/velocity", joint.c_str());
+    }
+    std::fprintf(out, "\n");
+
+    double max_deviation = 0.0;
+    size_t replayed = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t record = 0; record < recording.size(); ++record, ++replayed)
+    {
+      const unsigned long sequence = recording.sequence(record);
+      const bool activation = recording.event(record, FlightRecorder::ACTIVATION);
+      if (record > 0 && !activation && sequence != recording.sequence(record - 1) + 1)
+      {
+        std::fprintf(stderr, "Samples were dropped before sequence %lu. Stopping the replay.\n", sequence);
+        break;
+      }
+      if (recording.event(record, FlightRecorder::MODEL_SWAP))
+      {
+        std::fprintf(stderr, "The robot model was reloaded before sequence %lu. Stopping the replay.\n", sequence);
+        break;
+      }
+
+      // The controllers record their start state on activation
+      if (record == 0 || activation)
+      {
+        replay.start(recording, record);
+      }
+      else
+      {
+        replay.update(recording, record);
+      }
+
+      const auto& motion = replay.simulatedJointMotion();
+      const double* recorded = recording.field(record, FlightRecorder::SIMULATED_POSITIONS);
+      for (size_t i = 0; i < number_joints; ++i)
+      {
+        max_deviation = std::max(max_deviation, std::abs(motion.positions[i] - recorded[i]));
+      }
+
+      std::fprintf(out, "%lu %d", sequence, replay.lastIterations());
+      for (int i = 0; i < 6; ++i)
+      {
+        std::fprintf(out, " %.17g", replay.cartesianInput()[i]);
+      }
+      for (const auto& position : motion.positions)
+      {
+        std::fprintf(out, " %.17g", position);
+      }
+      for (const auto& velocity : motion.velocities)
+      {
+        std::fprintf(out, " %.17g", velocity);
+      }
+      std::fprintf(out, "\n");
+    }
+    const double elapsed =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (out != stdout)
+    {
+      std::fclose(out);
+    }
+
+    const double recorded = replayed > 0 ? (recording.stamp(replayed - 1) - recording.stamp(0)) * 1e-9 : 0.0;
+    std::fprintf(stderr,
+                 "Replayed %zu of %zu cycles in %.3f s (recorded: %.3f s, %.1fx real time)\n"
+                 "Samples dropped while recording: %lu\n"
+                 "Max. deviation from the recorded joint positions: %.17g\n",
+                 replayed,
+                 recording.size(),
+                 elapsed,
+                 recorded,
+                 elapsed > 0.0 ? recorded / elapsed : 0.0,
+                 static_cast<unsigned long>(recording.header().samples_dropped),
+                 max_deviation);
+  }
+
+  rclcpp::shutdown();
+  return 0;
+}
@@ -41,6 +41,7 @@
 #define MOTION_CONTROL_HANDLE_H_INCLUDED
 
 #include "cartesian_controller_base/ROS2VersionConfig.h"
+#include "cartesian_controller_base/RobotModel.h"
 #include "geometry_msgs/msg/detail/pose_stamped__struct.hpp"
 #include "geometry_msgs/msg/pose_stamped.hpp"
 #include "rclcpp/publisher.hpp"
@@ -165,6 +166,7 @@ class MotionControlHandle : public controller_interface::ControllerInterface
     std::string   m_end_effector_link;
     std::string   m_target_frame_topic;
     KDL::Chain    m_robot_chain;
+    std::shared_ptr<const cartesian_controller_base::RobotModel> m_robot_model;
     std::shared_ptr<
       KDL::ChainFkSolverPos_recursive>  m_fk_solver;
 
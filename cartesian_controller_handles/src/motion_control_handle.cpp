@@ -43,9 +43,6 @@
 #include "rclcpp/time.hpp"
 #include "visualization_msgs/msg/detail/interactive_marker_feedback__struct.hpp"
 #include <cartesian_controller_handles/motion_control_handle.h>
-#include <kdl/tree.hpp>
-#include <kdl_parser/kdl_parser.hpp>
-#include <urdf/model.h>
 
 
 namespace cartesian_controller_handles {
@@ -152,9 +149,6 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn
 MotionControlHandle::on_configure(const rclcpp_lifecycle::State& previous_state)
 {
   // Get kinematics specific configuration
-  urdf::Model robot_model;
-  KDL::Tree robot_tree;
-
   std::string robot_description = get_node()->get_parameter("robot_description").as_string();
   if (robot_description.empty())
   {
@@ -174,25 +168,17 @@ MotionControlHandle::on_configure(const rclcpp_lifecycle::State& previous_state)
     return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
   }
 
-  // Build a kinematic chain of the robot
-  if (!robot_model.initString(robot_description))
-  {
-    RCLCPP_ERROR(get_node()->get_logger(), "Failed to parse urdf model from 'robot_description'");
-    return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
-  }
-  if (!kdl_parser::treeFromUrdfModel(robot_model, robot_tree))
-  {
-    RCLCPP_ERROR(get_node()->get_logger(), "Failed to parse KDL tree from urdf model");
-    return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
-  }
-  if (!robot_tree.getChain(m_robot_base_link, m_end_effector_link, m_robot_chain))
+  // Build a kinematic chain of the robot.
+  // The controllers of this robot in the process share the model.
+  std::string error;
+  m_robot_model = cartesian_controller_base::loadRobotModel(
+    robot_description, m_robot_base_link, m_end_effector_link, error);
+  if (!m_robot_model)
   {
-    const std::string error = ""
-                              "Failed to parse robot chain from urdf model. "
-                              "Do robot_base_link and end_effector_link exist?";
     RCLCPP_ERROR(get_node()->get_logger(), "%s", error.c_str());
     return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
   }
+  m_robot_chain = m_robot_model->chain;
 
   // Get names of the joints
   m_joint_names = get_node()->get_parameter("joints").as_string_array();
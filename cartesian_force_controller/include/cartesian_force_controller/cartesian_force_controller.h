@@ -41,8 +41,11 @@
 #define CARTESIAN_FORCE_CONTROLLER_H_INCLUDED
 
 #include "geometry_msgs/msg/wrench_stamped.hpp"
+#include <cartesian_controller_base/ParameterSnapshot.h>
 #include <cartesian_controller_base/ROS2VersionConfig.h>
+#include <cartesian_controller_base/TripleBuffer.h>
 #include <cartesian_controller_base/cartesian_controller_base.h>
+#include <cartesian_controller_base/core/CartesianMath.h>
 #include <controller_interface/controller_interface.hpp>
 
 namespace cartesian_force_controller
@@ -106,8 +109,23 @@ class CartesianForceController : public virtual cartesian_controller_base::Carte
      */
     ctrl::Vector6D        computeForceError();
     std::string           m_new_ft_sensor_ref;
+    int                   m_new_ft_sensor_ref_index = {-1};
     void setFtSensorReferenceFrame(const std::string& new_ref);
 
+    /**
+     * @brief Recompute the transform from the sensor's frame to \ref m_new_ft_sensor_ref
+     *
+     * Realtime-safe.  Required after the robot model has changed.
+     */
+    void updateFtSensorTransform();
+
+    /**
+     * @brief Pick up the latest target and sensor wrenches from the subscribers
+     *
+     * Call this once at the beginning of each control cycle.
+     */
+    void fetchWrenches();
+
   private:
     ctrl::Vector6D        compensateGravity();
 
@@ -118,16 +136,19 @@ class CartesianForceController : public virtual cartesian_controller_base::Carte
     rclcpp::Subscription<geometry_msgs::msg::WrenchStamped>::SharedPtr m_ft_sensor_wrench_subscriber;
     ctrl::Vector6D        m_target_wrench;
     ctrl::Vector6D        m_ft_sensor_wrench;
+    ctrl::Vector6D        m_ft_sensor_measurement;  ///< in the sensor's frame
+
+    // Lock-free handover from the subscriber callbacks to update()
+    cartesian_controller_base::TripleBuffer<ctrl::Vector6D> m_target_wrench_buffer;
+    cartesian_controller_base::TripleBuffer<ctrl::Vector6D> m_ft_sensor_wrench_buffer;
     std::string           m_ft_sensor_ref_link;
+    int                   m_ft_sensor_ref_index = {-1};
     KDL::Frame            m_ft_sensor_transform;
+    size_t                m_ft_sensor_model_swaps = {0};  ///< see Base::modelSwapCount()
 
-    /**
-     * Allow users to choose whether to specify their target wrenches in the
-     * end-effector frame (= True) or the base frame (= False). The first one
-     * is easier for explicit task programming, while the second one is more
-     * intuitive for tele-manipulation.
-     */
-    bool m_hand_frame_control;
+    // Dynamic parameters
+    using ForceParameters = cartesian_controller_base::core::ForceErrorParameters;
+    cartesian_controller_base::ParameterSnapshot<ForceParameters> m_force_parameters;
 
 };
 
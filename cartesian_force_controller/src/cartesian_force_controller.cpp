@@ -46,7 +46,7 @@ namespace cartesian_force_controller
 {
 
 CartesianForceController::CartesianForceController()
-: Base::CartesianControllerBase(), m_hand_frame_control(true)
+: Base::CartesianControllerBase()
 {
 }
 
@@ -103,6 +103,22 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn Cartes
   // Make sure sensor wrenches are interpreted correctly
   setFtSensorReferenceFrame(Base::m_end_effector_link);
 
+  // Realtime-safe access to dynamic parameters
+  if (!m_force_parameters.init(
+        get_node(),
+        {"hand_frame_control"},
+        [](const rclcpp::Parameter& parameter, ForceParameters& params, std::string& reason) {
+          if (parameter.get_name() == "hand_frame_control")
+          {
+            return cartesian_controller_base::parameters::assign(
+              parameter, params.hand_frame_control, reason);
+          }
+          return true;
+        }))
+  {
+    return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
+  }
+
   m_target_wrench_subscriber = get_node()->create_subscription<geometry_msgs::msg::WrenchStamped>(
     get_node()->get_name() + std::string("/target_wrench"),
     10,
@@ -116,6 +132,7 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn Cartes
 
   m_target_wrench.setZero();
   m_ft_sensor_wrench.setZero();
+  m_ft_sensor_measurement.setZero();
 
   return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::SUCCESS;
 }
@@ -141,19 +158,32 @@ controller_interface::return_type CartesianForceController::update(const rclcpp:
 controller_interface::return_type CartesianForceController::update()
 #endif
 {
+#if defined CARTESIAN_CONTROLLERS_FOXY
+  // Unknown control period.  This disables time budgets.
+  const auto period = rclcpp::Duration::from_seconds(0.0);
+#endif
+
   // Synchronize the internal model and the real robot
-  Base::m_ik_solver->synchronizeJointPositions(Base::m_joint_state_pos_handles);
+  {
+    CARTESIAN_CONTROLLERS_MEASURE_LATENCY(Base::m_latencies[Base::JOINT_STATE_SYNC]);
+    Base::m_ik_solver->synchronizeJointPositions(Base::m_joint_state_pos_handles);
+  }
+  Base::applyToolFrame();
+  fetchWrenches();
 
   // Control the robot motion in such a way that the resulting net force
   // vanishes.  The internal 'simulation time' is deliberately independent of
   // the outer control cycle.
   auto internal_period = rclcpp::Duration::from_seconds(0.02);
 
-  // Compute the net force
-  ctrl::Vector6D error = computeForceError();
-
-  // Turn Cartesian error into joint motion
-  Base::computeJointControlCmds(error,internal_period);
+  // Run the solver only every solver.decimation cycles and extrapolate the
+  // joint commands in between
+  if (!Base::extrapolateJointControlCmds())
+  {
+    // Turn the net force into joint motion with a single step.  This still
+    // accounts the step against the time budget.
+    Base::iterateJointControlCmds([this]() { return computeForceError(); }, internal_period, period, 1);
+  }
 
   // Write final commands to the hardware interface
   Base::writeJointControlCmds();
@@ -163,49 +193,86 @@ controller_interface::return_type CartesianForceController::update()
 
 ctrl::Vector6D CartesianForceController::computeForceError()
 {
-  ctrl::Vector6D target_wrench;
-  m_hand_frame_control = get_node()->get_parameter("hand_frame_control").as_bool();
-
-  if (m_hand_frame_control) // Assume end-effector frame by convention
-  {
-    target_wrench = Base::displayInBaseLink(m_target_wrench,Base::m_end_effector_link);
-  }
-  else // Default to robot base frame
-  {
-    target_wrench = m_target_wrench;
-  }
+  const auto& kinematics = Base::m_ik_solver->getKinematics();
 
   // Superimpose target wrench and sensor wrench in base frame
+  return cartesian_controller_base::core::computeForceError(
+    m_force_parameters.get(),
+    m_target_wrench,
+    m_ft_sensor_wrench,
+    kinematics.getTipFrame().M,
 #if defined CARTESIAN_CONTROLLERS_GALACTIC || defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
-  return Base::displayInBaseLink(m_ft_sensor_wrench,m_new_ft_sensor_ref) + target_wrench;
+    kinematics.getFrame(m_new_ft_sensor_ref_index).M);
 #elif defined CARTESIAN_CONTROLLERS_FOXY
-  return m_ft_sensor_wrench + target_wrench;
+    KDL::Rotation::Identity());
 #endif
 }
 
 void CartesianForceController::setFtSensorReferenceFrame(const std::string& new_ref)
 {
-  // Compute static transform from the force torque sensor to the new reference
-  // frame of interest.
   m_new_ft_sensor_ref = new_ref;
+  m_new_ft_sensor_ref_index = Base::linkIndex(m_new_ft_sensor_ref);
+  m_ft_sensor_ref_index = Base::linkIndex(m_ft_sensor_ref_link);
+  updateFtSensorTransform();
+}
 
+void CartesianForceController::updateFtSensorTransform()
+{
+  // Compute static transform from the force torque sensor to the new reference
+  // frame of interest.
   // Joint positions should cancel out, i.e. it doesn't matter as long as they
   // are the same for both transformations.
-  KDL::JntArray jnts(Base::m_ik_solver->getPositions());
+  const auto& kinematics = Base::m_ik_solver->getKinematics();
+  const KDL::Frame& sensor_ref = kinematics.getFrame(m_ft_sensor_ref_index);
+  const KDL::Frame& new_sensor_ref = kinematics.getFrame(m_new_ft_sensor_ref_index);
 
-  KDL::Frame sensor_ref;
-  Base::m_forward_kinematics_solver->JntToCart(
-      jnts,
-      sensor_ref,
-      m_ft_sensor_ref_link);
+  m_ft_sensor_transform = new_sensor_ref.Inverse() * sensor_ref;
+  m_ft_sensor_model_swaps = Base::modelSwapCount();
+}
 
-  KDL::Frame new_sensor_ref;
-  Base::m_forward_kinematics_solver->JntToCart(
-      jnts,
-      new_sensor_ref,
-      m_new_ft_sensor_ref);
+void CartesianForceController::fetchWrenches()
+{
+  if (m_target_wrench_buffer.read())
+  {
+    m_target_wrench = m_target_wrench_buffer.latest().data;
+  }
 
-  m_ft_sensor_transform = new_sensor_ref.Inverse() * sensor_ref;
+  // A new robot model can change the geometry between sensor and reference frame
+  bool new_ft_sensor_wrench = false;
+  if (Base::modelSwapCount() != m_ft_sensor_model_swaps)
+  {
+    updateFtSensorTransform();
+    new_ft_sensor_wrench = true;
+  }
+  if (m_ft_sensor_wrench_buffer.read())
+  {
+    m_ft_sensor_measurement = m_ft_sensor_wrench_buffer.latest().data;
+    new_ft_sensor_wrench = true;
+  }
+  if (new_ft_sensor_wrench)
+  {
+#if defined CARTESIAN_CONTROLLERS_GALACTIC || defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
+    KDL::Wrench tmp;
+    for (int i = 0; i < 6; ++i)
+    {
+      tmp[i] = m_ft_sensor_measurement[i];
+    }
+
+    // Compute how the measured wrench appears in the frame of interest.
+    tmp = m_ft_sensor_transform * tmp;
+
+    for (int i = 0; i < 6; ++i)
+    {
+      m_ft_sensor_wrench[i] = tmp[i];
+    }
+#elif defined CARTESIAN_CONTROLLERS_FOXY
+    // We assume base frame for the measurements
+    // This is currently URe-ROS2 driver-specific (branch foxy).
+    m_ft_sensor_wrench = m_ft_sensor_measurement;
+#endif
+  }
+  Base::m_flight_recorder.set(cartesian_controller_base::FlightRecorder::TARGET_WRENCH, m_target_wrench);
+  Base::m_flight_recorder.set(cartesian_controller_base::FlightRecorder::SENSOR_WRENCH, m_ft_sensor_wrench);
 }
 
 void CartesianForceController::targetWrenchCallback(const geometry_msgs::msg::WrenchStamped::SharedPtr wrench)
@@ -222,12 +289,14 @@ void CartesianForceController::targetWrenchCallback(const geometry_msgs::msg::Wr
     return;
   }
 
-  m_target_wrench[0] = wrench->wrench.force.x;
-  m_target_wrench[1] = wrench->wrench.force.y;
-  m_target_wrench[2] = wrench->wrench.force.z;
-  m_target_wrench[3] = wrench->wrench.torque.x;
-  m_target_wrench[4] = wrench->wrench.torque.y;
-  m_target_wrench[5] = wrench->wrench.torque.z;
+  ctrl::Vector6D target_wrench;
+  target_wrench[0] = wrench->wrench.force.x;
+  target_wrench[1] = wrench->wrench.force.y;
+  target_wrench[2] = wrench->wrench.force.z;
+  target_wrench[3] = wrench->wrench.torque.x;
+  target_wrench[4] = wrench->wrench.torque.y;
+  target_wrench[5] = wrench->wrench.torque.z;
+  m_target_wrench_buffer.write(target_wrench, get_node()->now());
 }
 
 void CartesianForceController::ftSensorWrenchCallback(const geometry_msgs::msg::WrenchStamped::SharedPtr wrench)
@@ -244,35 +313,16 @@ void CartesianForceController::ftSensorWrenchCallback(const geometry_msgs::msg::
     return;
   }
 
+  // Measured in the sensor's frame.  The control loop transforms it.
+  ctrl::Vector6D ft_sensor_wrench;
+  ft_sensor_wrench[0] = wrench->wrench.force.x;
+  ft_sensor_wrench[1] = wrench->wrench.force.y;
+  ft_sensor_wrench[2] = wrench->wrench.force.z;
+  ft_sensor_wrench[3] = wrench->wrench.torque.x;
+  ft_sensor_wrench[4] = wrench->wrench.torque.y;
+  ft_sensor_wrench[5] = wrench->wrench.torque.z;
 
-#if defined CARTESIAN_CONTROLLERS_GALACTIC || defined CARTESIAN_CONTROLLERS_HUMBLE || defined CARTESIAN_CONTROLLERS_IRON
-  KDL::Wrench tmp;
-  tmp[0] = wrench->wrench.force.x;
-  tmp[1] = wrench->wrench.force.y;
-  tmp[2] = wrench->wrench.force.z;
-  tmp[3] = wrench->wrench.torque.x;
-  tmp[4] = wrench->wrench.torque.y;
-  tmp[5] = wrench->wrench.torque.z;
-
-  // Compute how the measured wrench appears in the frame of interest.
-  tmp = m_ft_sensor_transform * tmp;
-
-  m_ft_sensor_wrench[0] = tmp[0];
-  m_ft_sensor_wrench[1] = tmp[1];
-  m_ft_sensor_wrench[2] = tmp[2];
-  m_ft_sensor_wrench[3] = tmp[3];
-  m_ft_sensor_wrench[4] = tmp[4];
-  m_ft_sensor_wrench[5] = tmp[5];
-#elif defined CARTESIAN_CONTROLLERS_FOXY
-  // We assume base frame for the measurements
-  // This is currently URe-ROS2 driver-specific (branch foxy).
-  m_ft_sensor_wrench[0] = wrench->wrench.force.x;
-  m_ft_sensor_wrench[1] = wrench->wrench.force.y;
-  m_ft_sensor_wrench[2] = wrench->wrench.force.z;
-  m_ft_sensor_wrench[3] = wrench->wrench.torque.x;
-  m_ft_sensor_wrench[4] = wrench->wrench.torque.y;
-  m_ft_sensor_wrench[5] = wrench->wrench.torque.z;
-#endif
+  m_ft_sensor_wrench_buffer.write(ft_sensor_wrench, get_node()->now());
 }
 
 }
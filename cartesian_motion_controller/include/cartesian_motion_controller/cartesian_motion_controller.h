@@ -41,9 +41,16 @@
 #define CARTESIAN_MOTION_CONTROLLER_H_INCLUDED
 
 #include "geometry_msgs/msg/pose_stamped.hpp"
+#include <cartesian_controller_base/ParameterSnapshot.h>
 #include <cartesian_controller_base/ROS2VersionConfig.h>
+#include <cartesian_controller_base/TripleBuffer.h>
 #include <cartesian_controller_base/cartesian_controller_base.h>
+#include <cartesian_controller_base/core/CartesianSpline.h>
+#include <cartesian_controller_base/core/TargetPredictor.h>
 #include <controller_interface/controller_interface.hpp>
+#include <memory>
+#include <mutex>
+#include <trajectory_msgs/msg/multi_dof_joint_trajectory.hpp>
 
 namespace cartesian_motion_controller
 {
@@ -65,6 +72,15 @@ namespace cartesian_motion_controller
  * smooth joint commands for distant, discretely sampled targets.
  * Users achieve this with setting qualitatively low P gains.
  *
+ * Late targets can be compensated with their header stamps.  The controller
+ * then extrapolates the latest target with its estimated velocity to the
+ * current control time, see \ref cartesian_controller_base::core::TargetPredictor.
+ *
+ * Alternatively, the controller receives whole trajectory segments as
+ * \a trajectory_msgs::msg::MultiDOFJointTrajectory and samples the target
+ * pose from a spline through the waypoints in each control cycle.  The most
+ * recent input of both kinds is followed.
+ *
  * For uses cases where a more precise tracking is needed, users may configure
  * this controller to a fast Inverse Kinematics solver, with setting
  * qualitatively high P gains and a higher number of internal solver iterations.
@@ -115,9 +131,66 @@ class CartesianMotionController : public virtual cartesian_controller_base::Cart
     KDL::Frame      m_target_frame;
     KDL::Frame      m_current_frame;
 
+    /**
+     * @brief Pick up the latest target frame from the subscribers
+     *
+     * Call this once at the beginning of each control cycle.  When following
+     * a trajectory, this samples the trajectory at the given time.  This also
+     * switches the tool center point, which then holds its current pose until
+     * newer targets arrive.
+     *
+     * @param time The time of this control cycle
+     */
+    void fetchTargetFrame(const rclcpp::Time& time);
+
     void targetFrameCallback(const geometry_msgs::msg::PoseStamped::SharedPtr target);
 
+    /**
+     * @brief Turn a trajectory message into spline coefficients
+     *
+     * Each point needs exactly one transform.  A zero header stamp starts the
+     * trajectory on reception.
+     */
+    void targetTrajectoryCallback(const trajectory_msgs::msg::MultiDOFJointTrajectory::SharedPtr trajectory);
+
+    //! Lock-free handover from the subscriber callback to update()
+    cartesian_controller_base::TripleBuffer<cartesian_controller_base::core::TargetPredictor::Prediction>
+      m_target_frame_buffer;
+
     rclcpp::Subscription<geometry_msgs::msg::PoseStamped>::SharedPtr m_target_frame_subscr;
+
+    //! Target history of the subscriber callback
+    cartesian_controller_base::core::TargetPredictor m_target_predictor;
+    std::mutex m_target_predictor_mutex;  ///< Between the subscriber callback and activation
+    uint64_t m_target_predictor_tool_frame_count = {0};  ///< see Base::toolFrameCount()
+
+    //! The latest target in update()
+    cartesian_controller_base::core::TargetPredictor::Prediction m_target_prediction;
+
+    struct PredictionParameters
+    {
+      double max_horizon = 0.0; ///< seconds
+    };
+    cartesian_controller_base::ParameterSnapshot<PredictionParameters> m_prediction_parameters;
+
+    //! A precomputed trajectory and when it starts
+    struct TargetTrajectory
+    {
+      std::shared_ptr<cartesian_controller_base::core::CartesianSpline> spline;  ///< Only update() sets its start
+      int64_t start = 0; ///< nanoseconds
+    };
+
+    /**
+     * Lock-free handover from the subscriber callback to update().  Previous
+     * trajectories are released on the subscriber's side when their slot is
+     * overwritten, so update() never frees memory.
+     */
+    cartesian_controller_base::TripleBuffer<TargetTrajectory> m_target_trajectory_buffer;
+
+    rclcpp::Subscription<trajectory_msgs::msg::MultiDOFJointTrajectory>::SharedPtr m_target_trajectory_subscr;
+
+    bool m_follow_trajectory = {false};
+    size_t m_trajectory_segment = {0};
 };
 
 }
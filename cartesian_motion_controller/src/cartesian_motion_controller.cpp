@@ -42,6 +42,7 @@
 #include "rclcpp/clock.hpp"
 #include "rclcpp/duration.hpp"
 #include <algorithm>
+#include <cartesian_controller_base/core/CartesianMath.h>
 #include <cartesian_motion_controller/cartesian_motion_controller.h>
 #include <cmath>
 
@@ -62,6 +63,10 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn Cartes
     return ret;
   }
 
+  auto_declare<double>("target_prediction.max_horizon", 0.0);
+  auto_declare<int>("target_prediction.history", 3);
+  auto_declare<double>("target_prediction.max_age", 0.5);
+
   return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::SUCCESS;
 }
 #elif defined CARTESIAN_CONTROLLERS_FOXY
@@ -73,6 +78,10 @@ controller_interface::return_type CartesianMotionController::init(const std::str
     return ret;
   }
 
+  auto_declare<double>("target_prediction.max_horizon", 0.0);
+  auto_declare<int>("target_prediction.history", 3);
+  auto_declare<double>("target_prediction.max_age", 0.5);
+
   return controller_interface::return_type::OK;
 }
 #endif
@@ -86,11 +95,44 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn Cartes
     return ret;
   }
 
+  // Latency compensation of target poses
+  const int history = get_node()->get_parameter("target_prediction.history").as_int();
+  if (history < 2)
+  {
+    RCLCPP_ERROR(get_node()->get_logger(), "target_prediction.history must be >= 2");
+    return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
+  }
+  const double max_age = get_node()->get_parameter("target_prediction.max_age").as_double();
+  if (max_age < 0.0)
+  {
+    RCLCPP_ERROR(get_node()->get_logger(), "target_prediction.max_age must be >= 0");
+    return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
+  }
+  m_target_predictor.init(history, max_age);
+  if (!m_prediction_parameters.init(
+        get_node(),
+        {"target_prediction.max_horizon"},
+        [](const rclcpp::Parameter& parameter, PredictionParameters& params, std::string& reason) {
+          if (parameter.get_name() == "target_prediction.max_horizon")
+          {
+            return cartesian_controller_base::parameters::assign(parameter, params.max_horizon, reason, 0.0);
+          }
+          return true;
+        }))
+  {
+    return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::ERROR;
+  }
+
   m_target_frame_subscr = get_node()->create_subscription<geometry_msgs::msg::PoseStamped>(
     get_node()->get_name() + std::string("/target_frame"),
     3,
     std::bind(&CartesianMotionController::targetFrameCallback, this, std::placeholders::_1));
 
+  m_target_trajectory_subscr = get_node()->create_subscription<trajectory_msgs::msg::MultiDOFJointTrajectory>(
+    get_node()->get_name() + std::string("/target_trajectory"),
+    3,
+    std::bind(&CartesianMotionController::targetTrajectoryCallback, this, std::placeholders::_1));
+
   return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::SUCCESS;
 }
 
@@ -102,8 +144,17 @@ rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn Cartes
   // Reset simulation with real joint state
   m_current_frame = Base::m_ik_solver->getEndEffectorPose();
 
-  // Start where we are
+  // Start where we are and discard targets that arrived while inactive
+  m_target_frame_buffer.read();
+  m_target_trajectory_buffer.read();
+  m_follow_trajectory = false;
   m_target_frame = m_current_frame;
+  m_target_prediction = cartesian_controller_base::core::TargetPredictor::Prediction();
+  m_target_prediction.pose = m_current_frame;
+  {
+    std::lock_guard<std::mutex> lock(m_target_predictor_mutex);
+    m_target_predictor.reset();
+  }
   return rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn::SUCCESS;
 }
 
@@ -121,24 +172,32 @@ controller_interface::return_type CartesianMotionController::update(const rclcpp
 controller_interface::return_type CartesianMotionController::update()
 #endif
 {
+#if defined CARTESIAN_CONTROLLERS_FOXY
+  // Unknown control period.  This disables time budgets.
+  const auto period = rclcpp::Duration::from_seconds(0.0);
+  const auto time = get_node()->now();
+#endif
+
   // Synchronize the internal model and the real robot
-  Base::m_ik_solver->synchronizeJointPositions(Base::m_joint_state_pos_handles);
+  {
+    CARTESIAN_CONTROLLERS_MEASURE_LATENCY(Base::m_latencies[Base::JOINT_STATE_SYNC]);
+    Base::m_ik_solver->synchronizeJointPositions(Base::m_joint_state_pos_handles);
+  }
+  fetchTargetFrame(time);
 
   // Forward Dynamics turns the search for the according joint motion into a
   // control process. So, we control the internal model until we meet the
   // Cartesian target motion. This internal control needs some simulation time
-  // steps.
-  for (int i = 0; i < Base::m_iterations; ++i)
-  {
-    // The internal 'simulation time' is deliberately independent of the outer
-    // control cycle.
-    auto internal_period = rclcpp::Duration::from_seconds(0.02);
+  // steps.  The internal 'simulation time' is deliberately independent of the
+  // outer control cycle.
+  auto internal_period = rclcpp::Duration::from_seconds(0.02);
 
-    // Compute the motion error = target - current.
-    ctrl::Vector6D error = computeMotionError();
-
-    // Turn Cartesian error into joint motion
-    Base::computeJointControlCmds(error,internal_period);
+  // Run the solver only every solver.decimation cycles and extrapolate the
+  // joint commands in between
+  if (!Base::extrapolateJointControlCmds())
+  {
+    // Turn the motion error = target - current into joint motion
+    Base::iterateJointControlCmds([this]() { return computeMotionError(); }, internal_period, period);
   }
 
   // Write final commands to the hardware interface
@@ -153,41 +212,53 @@ computeMotionError()
   // Compute motion error wrt robot_base_link
   m_current_frame = Base::m_ik_solver->getEndEffectorPose();
 
-  // Transformation from target -> current corresponds to error = target - current
-  KDL::Frame error_kdl;
-  error_kdl.M = m_target_frame.M * m_current_frame.M.Inverse();
-  error_kdl.p = m_target_frame.p - m_current_frame.p;
-
-  // Use Rodrigues Vector for a compact representation of orientation errors
-  // Only for angles within [0,Pi)
-  KDL::Vector rot_axis = KDL::Vector::Zero();
-  double angle    = error_kdl.M.GetRotAngle(rot_axis);   // rot_axis is normalized
-  double distance = error_kdl.p.Normalize();
-
-  // Clamp maximal tolerated error.
-  // The remaining error will be handled in the next control cycle.
-  // Note that this is also the maximal offset that the
-  // cartesian_compliance_controller can use to build up a restoring stiffness
-  // wrench.
-  const double max_angle = 1.0;
-  const double max_distance = 1.0;
-  angle    = std::clamp(angle,-max_angle,max_angle);
-  distance = std::clamp(distance,-max_distance,max_distance);
-
-  // Scale errors to allowed magnitudes
-  rot_axis = rot_axis * angle;
-  error_kdl.p = error_kdl.p * distance;
-
-  // Reassign values
-  ctrl::Vector6D error;
-  error(0) = error_kdl.p.x();
-  error(1) = error_kdl.p.y();
-  error(2) = error_kdl.p.z();
-  error(3) = rot_axis(0);
-  error(4) = rot_axis(1);
-  error(5) = rot_axis(2);
-
-  return error;
+  return cartesian_controller_base::core::computeMotionError(m_target_frame, m_current_frame);
+}
+
+void CartesianMotionController::fetchTargetFrame(const rclcpp::Time& time)
+{
+  // Targets for a previous tool center point don't apply to a new one
+  const bool new_tool = Base::applyToolFrame();
+  const bool new_frame = m_target_frame_buffer.read() &&
+    (!new_tool || m_target_frame_buffer.latest().stamp >= Base::toolFrameStamp());
+  const bool new_trajectory = m_target_trajectory_buffer.read() &&
+    (!new_tool || m_target_trajectory_buffer.latest().stamp >= Base::toolFrameStamp());
+
+  // Hold a new tool center point where it is
+  if (new_tool)
+  {
+    m_follow_trajectory = false;
+    m_target_prediction = cartesian_controller_base::core::TargetPredictor::Prediction();
+    m_target_prediction.pose = Base::m_ik_solver->getEndEffectorPose();
+  }
+
+  // Follow the most recent input
+  if (new_trajectory &&
+      (!new_frame || m_target_trajectory_buffer.latest().stamp >= m_target_frame_buffer.latest().stamp))
+  {
+    m_follow_trajectory = true;
+    m_trajectory_segment = 0;
+    m_target_trajectory_buffer.latest().data.spline->setStart(Base::m_ik_solver->getEndEffectorPose());
+  }
+  else if (new_frame)
+  {
+    m_follow_trajectory = false;
+    m_target_prediction = m_target_frame_buffer.latest().data;
+  }
+
+  if (m_follow_trajectory)
+  {
+    const TargetTrajectory& trajectory = m_target_trajectory_buffer.latest().data;
+    m_target_frame = trajectory.spline->evaluate(
+      (time.nanoseconds() - trajectory.start) * 1e-9, m_trajectory_segment);
+  }
+  else
+  {
+    // Compensate the target's latency
+    m_target_frame = cartesian_controller_base::core::TargetPredictor::extrapolate(
+      m_target_prediction, time.nanoseconds(), m_prediction_parameters.get().max_horizon);
+  }
+  Base::m_flight_recorder.set(cartesian_controller_base::FlightRecorder::TARGET_FRAME, m_target_frame);
 }
 
 void CartesianMotionController::targetFrameCallback(const geometry_msgs::msg::PoseStamped::SharedPtr target)
@@ -216,16 +287,94 @@ void CartesianMotionController::targetFrameCallback(const geometry_msgs::msg::Po
     return;
   }
 
-  m_target_frame = KDL::Frame(
+  // Targets without stamp count as created on reception
+  const rclcpp::Time now = get_node()->now();
+  const rclcpp::Time stamp(target->header.stamp, now.get_clock_type());
+  const KDL::Frame frame(
+    KDL::Rotation::Quaternion(
+      target->pose.orientation.x,
+      target->pose.orientation.y,
+      target->pose.orientation.z,
+      target->pose.orientation.w),
+    KDL::Vector(
+      target->pose.position.x,
+      target->pose.position.y,
+      target->pose.position.z));
+  std::lock_guard<std::mutex> lock(m_target_predictor_mutex);
+
+  // Without prediction, each target stands on its own and its order doesn't matter.
+  // Targets for a previous tool center point don't tell the motion of the new one.
+  const uint64_t tool_frame_count = Base::toolFrameCount();
+  if (m_prediction_parameters.getNonRT().max_horizon <= 0.0 ||
+      tool_frame_count != m_target_predictor_tool_frame_count)
+  {
+    m_target_predictor.reset();
+    m_target_predictor_tool_frame_count = tool_frame_count;
+  }
+  if (!m_target_predictor.add(stamp.nanoseconds() > 0 ? stamp.nanoseconds() : now.nanoseconds(), frame))
+  {
+    auto& clock = *get_node()->get_clock();
+    RCLCPP_WARN_THROTTLE(get_node()->get_logger(),
+        clock, 3000,
+        "Got target pose out of order. Ignoring input.");
+    return;
+  }
+
+  m_target_frame_buffer.write(m_target_predictor.prediction(), now);
+}
+
+void CartesianMotionController::targetTrajectoryCallback(
+  const trajectory_msgs::msg::MultiDOFJointTrajectory::SharedPtr trajectory)
+{
+  auto& clock = *get_node()->get_clock();
+  if (trajectory->header.frame_id != Base::m_robot_base_link)
+  {
+    RCLCPP_WARN_THROTTLE(get_node()->get_logger(),
+        clock, 3000,
+        "Got target trajectory in wrong reference frame. Expected: %s but got %s",
+        Base::m_robot_base_link.c_str(),
+        trajectory->header.frame_id.c_str());
+    return;
+  }
+
+  std::vector<cartesian_controller_base::core::CartesianSpline::Waypoint> waypoints(trajectory->points.size());
+  for (size_t i = 0; i < trajectory->points.size(); ++i)
+  {
+    const auto& point = trajectory->points[i];
+    if (point.transforms.size() != 1)
+    {
+      RCLCPP_WARN_THROTTLE(get_node()->get_logger(),
+          clock, 3000,
+          "Expected one transform per trajectory point but got %zu. Ignoring input.",
+          point.transforms.size());
+      return;
+    }
+    const auto& transform = point.transforms[0];
+    waypoints[i].time = rclcpp::Duration(point.time_from_start).seconds();
+    waypoints[i].pose = KDL::Frame(
       KDL::Rotation::Quaternion(
-        target->pose.orientation.x,
-        target->pose.orientation.y,
-        target->pose.orientation.z,
-        target->pose.orientation.w),
+        transform.rotation.x,
+        transform.rotation.y,
+        transform.rotation.z,
+        transform.rotation.w),
       KDL::Vector(
-        target->pose.position.x,
-        target->pose.position.y,
-        target->pose.position.z));
+        transform.translation.x,
+        transform.translation.y,
+        transform.translation.z));
+  }
+
+  auto spline = std::make_shared<cartesian_controller_base::core::CartesianSpline>();
+  std::string error;
+  if (!spline->init(waypoints, error))
+  {
+    RCLCPP_WARN_THROTTLE(get_node()->get_logger(), clock, 3000, "Ignoring target trajectory: %s", error.c_str());
+    return;
+  }
+
+  const rclcpp::Time now = get_node()->now();
+  const rclcpp::Time start(trajectory->header.stamp, now.get_clock_type());
+  m_target_trajectory_buffer.write(
+    TargetTrajectory{spline, start.nanoseconds() > 0 ? start.nanoseconds() : now.nanoseconds()}, now);
 }
 
 } // namespace